@@ -94,6 +94,12 @@ func Handler(args []string) error {
 		w := distributeArgs()
 		logLoop(w) // endless loop
 		return nil
+	case "spans":
+		msg.OnErr(fsScLog.Parse(subArgs))
+		w := distributeArgs()
+		decoder.SpansOnly = true
+		logLoop(w) // endless loop
+		return nil
 	}
 }
 
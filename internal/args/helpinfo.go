@@ -28,6 +28,7 @@ func scHelp(w io.Writer) error {
 		{allHelp || renewHelp, renewInfo},
 		{allHelp || scanHelp, scanInfo},
 		{allHelp || shutdownHelp, shutdownInfo},
+		{allHelp || spansHelp, spansInfo},
 		{allHelp || versionHelp, versionInfo},
 		{allHelp || updateHelp, updateInfo},
 		{allHelp || zeroIDsHelp, zeroIDsInfo},
@@ -118,6 +119,16 @@ func shutdownInfo(w io.Writer) error {
 	return e
 }
 
+func spansInfo(w io.Writer) error {
+	_, e := fmt.Fprintln(w, `sub-command 'spans': For profiling with the target TRICE_SPAN_BEGIN and TRICE_SPAN_END macros.
+	"trice spans" accepts the same switches as "trice log", but shows only the span statistics instead of the trice logs.
+	For each span name count, min, avg, max and 99th percentile in TRICE_SPAN_CLOCK ticks and a histogram are shown
+	at the end of a -port FILEBUFFER input or on CTRL-C. "trice log" shows them too, if the target sent spans.`)
+	fmt.Fprintln(w, "example: 'trice spans -p J-LINK': Collect spans until CTRL-C.")
+	fmt.Fprintln(w, "example: 'trice spans -p FILEBUFFER -args trice.bin': Show the spans inside a binary log file.")
+	return e
+}
+
 func updateInfo(w io.Writer) error {
 	_, e := fmt.Fprintln(w, `sub-command 'u|update': For updating ID list and source files.
 	"trice update" will parse source tree(s) for new or changed TRICE macros, modify them appropriate and update/generate the JSON list.
@@ -66,6 +66,7 @@ func helpInit() {
 	fsScHelp.BoolVar(&scanHelp, "s", false, "Show s|scan specific help.")
 	fsScHelp.BoolVar(&shutdownHelp, "shutdown", false, "Show sd|shutdown specific help.")
 	fsScHelp.BoolVar(&shutdownHelp, "sd", false, "Show sd|shutdown specific help.")
+	fsScHelp.BoolVar(&spansHelp, "spans", false, "Show spans specific help.")
 	fsScHelp.BoolVar(&updateHelp, "update", false, "Show u|update specific help.")
 	fsScHelp.BoolVar(&updateHelp, "u", false, "Show u|update specific help.")
 	fsScHelp.BoolVar(&versionHelp, "version", false, "Show ver|version specific help.")
@@ -78,9 +79,10 @@ func helpInit() {
 
 func logInit() {
 	fsScLog = flag.NewFlagSet("log", flag.ExitOnError) // sub-command
-	fsScLog.StringVar(&decoder.Encoding, "encoding", "COBS", `The trice transmit data format type, options: '(CHAR|COBS|dumpDec|ESC|FLEX)'. Target device encoding must match. 
+	fsScLog.StringVar(&decoder.Encoding, "encoding", "COBS", `The trice transmit data format type, options: '(CHAR|COBS|TCOBS|dumpDec|ESC|FLEX)'. Target device encoding must match. 
 		  CHAR prints the received bytes as characters.
 		  COBS expects 0 delimited byte sequences.
+		  TCOBS expects 0 delimited TCOBS byte sequences (target with TRICE_TCOBS).
 		  dumpDec prints the received bytes as hex code (see switch -dc too).
 `) // flag
 	fsScLog.StringVar(&decoder.Encoding, "e", "COBS", "Short for -encoding.") // short flag
@@ -88,6 +90,10 @@ func logInit() {
 	fsScLog.StringVar(&cipher.Password, "password", "", `The decrypt passphrase. If you change this value you need to compile the target with the appropriate key (see -showKeys).
 Encryption is recommended if you deliver firmware to customers and want protect the trice log output. This does work right now only with flex and flexL format.`) // flag
 	fsScLog.StringVar(&cipher.Password, "pw", "", "Short for -password.") // short flag
+	fsScLog.StringVar(&cipher.Mode, "cipherMode", "ECB", `The decrypt mode, options: 'ECB|CTR'. Target device encryption must match.
+		  ECB decrypts each 8 byte block (target with TRICE_ENCRYPT).
+		  CTR expects keystream counter and nonce in front of each package (target with TRICE_ENCRYPT_CTR).
+`) // flag
 	fsScLog.BoolVar(&cipher.ShowKey, "showKey", false, `Show encryption key. Use this switch for creating your own password keys. If applied together with "-password MySecret" it shows the encryption key.
 Simply copy this key than into the line "#define ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret" inside triceConfig.h.
 `+boolInfo)
@@ -106,12 +112,18 @@ If you need target timestamps you need to get the time inside the target and sen
 	fsScLog.StringVar(&decoder.ShowTargetLocation, "tLocFmt", "%20s:%4d ", `Target location format string at start of each line, if target location existent (configured). Use "" to suppress existing target location. If several trices form a log line only the location of first trice ist displayed.`)
 	fsScLog.StringVar(&decoder.ShowTargetTimestamp, "ttsf", "time:%9d ", `Target timestamp format string at start of each line, if target timestamps existent (configured). Use "" to suppress existing target timestamps. If several trices form a log line only the timestamp of first trice ist displayed.`)
 	fsScLog.BoolVar(&decoder.DebugOut, "debug", false, "Show additional debug information")
+	fsScLog.StringVar(&decoder.ElfFile, "elf", "", `Target ELF file with the function names for -traceFile and -flameFile. Without it the function addresses are shown.`)
+	fsScLog.StringVar(&decoder.FlameFile, "flameFile", "", `Output file for the target function trace, see TRICE_FUNCTION_TRACE, as folded stacks with self time clock ticks for flame graph tools. It is written at the end of a file input or on CTRL-C.`)
+	fsScLog.StringVar(&decoder.TraceFile, "traceFile", "", `Output file for the target function trace, see TRICE_FUNCTION_TRACE, in the Chrome trace event JSON format. Open it with https://ui.perfetto.dev. It is written at the end of a file input or on CTRL-C.`)
+	fsScLog.Float64Var(&decoder.TraceClock, "traceClock", 1, `TRICE_FUNCTION_CLOCK frequency in MHz for the microsecond timestamps inside -traceFile.`)
+	fsScLog.IntVar(&decoder.ReorderWindow, "reorder", 256, `Max count of trices from core tagged packages, see TRICE_RING_CORES, held back for merging the core streams by target timestamp. 0 merges package by package.`)
+	fsScLog.StringVar(&decoder.FragmentDir, "fragmentDir", "", `Directory for buffers streamed by the target in fragments, see TRICE_FRAGMENTS. Each reassembled buffer is written into a new file there. Default is "", what formats the buffer like a TRICE_N.`)
 	fsScLog.StringVar(&decoder.TargetEndianness, "targetEndianess", "littleEndian", `Target endianness trice data stream. Option: "bigEndian".`)
 	fsScLog.StringVar(&emitter.ColorPalette, "color", "default", colorInfo)                                                                                                                                        // flag
 	fsScLog.StringVar(&emitter.Prefix, "prefix", defaultPrefix, "Line prefix, options: any string or 'off|none' or 'source:' followed by 0-12 spaces, 'source:' will be replaced by source value e.g., 'COM17:'.") // flag
 	fsScLog.StringVar(&emitter.Suffix, "suffix", "", "Append suffix to all lines, options: any string.")                                                                                                           // flag
 
-	info := `receiver device: 'BUFFER|DUMP|FILE|FILEBUFFER|JLINK|STLINK|TCP4|serial name. 
+	info := `receiver device: 'BUFFER|DUMP|FILE|FILEBUFFER|JLINK|SHM:name|STLINK|TCP4|UNIX|serial name. 
 The serial name is like 'COM12' for Windows or a Linux name like '/dev/tty/usb12'. 
 Using a virtual serial COM port on the PC over a FTDI USB adapter is a most likely variant.
 `
@@ -135,7 +147,9 @@ port "FILE": default="`, receiver.DefaultFileArgs, `", Option for args is any fi
 port "FILEBUFFER": default="`, receiver.DefaultFileArgs, `", Option for args is any file name. Trice stops on EOF.
 port "J-LINK": default="`, receiver.DefaultLinkArgs, `", `, linkArgsInfo, `
 port "ST-LINK": default="`, receiver.DefaultLinkArgs, `", `, linkArgsInfo, `
+port "SHM": default="`, receiver.DefaultSHMArgs, `", Option for args is the shared memory object name a TRICE_LINUX target writes into. "-p SHM:/trice" is the same as "-p SHM -args /trice".
 port "TCP4": default="`, receiver.DefaultTCP4Args, `", use any IP:port endpoint like "127.0.0.1:19021"
+port "UNIX": default="`, receiver.DefaultUNIXArgs, `", Option for args is the Unix domain socket path trice listens on for a TRICE_LINUX target.
 `)
 
 	fsScLog.StringVar(&receiver.PortArguments, "args", "default", argsInfo)
@@ -185,6 +199,7 @@ func updateInit() {
 	fsScUpdate.Var(&id.Min, "IDMin", "Lower end of ID range for normal trices.")
 	fsScUpdate.Var(&id.Max, "IDMax", "Upper end of ID range for normal trices.")
 	fsScUpdate.StringVar(&id.SearchMethod, "IDMethod", "random", "Search method for new ID's in range- Options are 'upward', 'downward' & 'random'.")
+	fsScUpdate.StringVar(&id.FnTilH, "tilh", "", `C header file with channel, level and parameter size per ID, generated from the ID list, like "til.h". Empty means no header.`)
 	fsScUpdate.BoolVar(&id.ExtendMacrosWithParamCount, "addParamCount", false, "Extend TRICE macro names with the parameter count _n to enable compile time checks.")
 	fsScUpdate.BoolVar(&id.SharedIDs, "sharedIDs", false, `ID policy:
 true: TriceFmt's without TriceID get equal TriceID if an equal TriceFmt exists already.
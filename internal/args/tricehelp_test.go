@@ -132,6 +132,8 @@ func _TestHelpUpdate(t *testing.T) {
         -til string
               Short for '-idlist'.
                (default "til.json")
+        -tilh string
+              C header file with channel, level and parameter size per ID, generated from the ID list, like "til.h". Empty means no header.
         -v    short for verbose
         -verbose
               Gives more informal output if used. Can be helpful during setup.
@@ -265,6 +267,8 @@ func _TestHelpHelp(t *testing.T) {
                   Show sd|shutdown specific help.
         -shutdown
                   Show sd|shutdown specific help.
+        -spans
+                  Show spans specific help.
         -u    Show u|update specific help.
         -update
                   Show u|update specific help.
@@ -446,6 +450,8 @@ func _TestHelpLog(t *testing.T) {
               Short for '-displayserver'.
         -e string
               Short for -encoding. (default "COBS")
+        -elf string
+              Target ELF file with the function names for -traceFile and -flameFile. Without it the function addresses are shown.
         -encoding string
               The trice transmit data format type, options: '(CHAR|COBS|DUMP|ESC|FLEX)'. Target device encoding must match.
                                 CHAR prints the received bytes as characters.
@@ -454,6 +460,10 @@ func _TestHelpLog(t *testing.T) {
                                 ESC is a legacy format and will be removed in the future.
                                 FLEX is a legacy format and will be removed in the future.
                (default "COBS")
+        -flameFile string
+              Output file for the target function trace, see TRICE_FUNCTION_TRACE, as folded stacks with self time clock ticks for flame graph tools. It is written at the end of a file input or on CTRL-C.
+        -fragmentDir string
+              Directory for buffers streamed by the target in fragments, see TRICE_FRAGMENTS. Each reassembled buffer is written into a new file there. Default is "", what formats the buffer like a TRICE_N.
         -i string
               Short for '-idlist'.
                (default "til.json")
@@ -498,6 +508,8 @@ func _TestHelpLog(t *testing.T) {
               Line prefix, options: any string or 'off|none' or 'source:' followed by 0-12 spaces, 'source:' will be replaced by source value e.g., 'COM17:'. (default "source: ")
         -pw string
               Short for -password.
+        -reorder int
+              Max count of trices from core tagged packages, see TRICE_RING_CORES, held back for merging the core streams by target timestamp. 0 merges package by package. (default 256)
         -s    Short for '-showInputBytes'.
         -showID string
               Format string for displaying first trice ID at start of each line. Example: "debug:%7d ". Default is "". If several trices form a log line only the first trice ID ist displayed.
@@ -519,6 +531,10 @@ func _TestHelpLog(t *testing.T) {
         -til string
               Short for '-idlist'.
                (default "til.json")
+        -traceClock float
+              TRICE_FUNCTION_CLOCK frequency in MHz for the microsecond timestamps inside -traceFile. (default 1)
+        -traceFile string
+              Output file for the target function trace, see TRICE_FUNCTION_TRACE, in the Chrome trace event JSON format. Open it with https://ui.perfetto.dev. It is written at the end of a file input or on CTRL-C.
         -ts string
               PC timestamp for logs and logfile name, options: 'off|none|UTCmicro|zero'
               This timestamp switch generates the timestamps on the PC only (reception time), what is good enough for many cases.
@@ -71,6 +71,8 @@ func _TestHelpAll(t *testing.T) {
               Show sd|shutdown specific help.
         -shutdown
               Show sd|shutdown specific help.
+        -spans
+              Show spans specific help.
         -u    Show u|update specific help.
         -update
               Show u|update specific help.
@@ -126,6 +128,8 @@ func _TestHelpAll(t *testing.T) {
               Short for '-displayserver'.
         -e string
               Short for -encoding. (default "COBS")
+        -elf string
+              Target ELF file with the function names for -traceFile and -flameFile. Without it the function addresses are shown.
         -encoding string
               The trice transmit data format type, options: '(CHAR|COBS|DUMP|ESC|FLEX)'. Target device encoding must match.
                                 CHAR prints the received bytes as characters.
@@ -134,6 +138,10 @@ func _TestHelpAll(t *testing.T) {
                                 ESC is a legacy format and will be removed in the future.
                                 FLEX is a legacy format and will be removed in the future.
                (default "COBS")
+        -flameFile string
+              Output file for the target function trace, see TRICE_FUNCTION_TRACE, as folded stacks with self time clock ticks for flame graph tools. It is written at the end of a file input or on CTRL-C.
+        -fragmentDir string
+              Directory for buffers streamed by the target in fragments, see TRICE_FRAGMENTS. Each reassembled buffer is written into a new file there. Default is "", what formats the buffer like a TRICE_N.
         -i string
               Short for '-idlist'.
                (default "til.json")
@@ -178,6 +186,8 @@ func _TestHelpAll(t *testing.T) {
               Line prefix, options: any string or 'off|none' or 'source:' followed by 0-12 spaces, 'source:' will be replaced by source value e.g., 'COM17:'. (default "source: ")
         -pw string
               Short for -password.
+        -reorder int
+              Max count of trices from core tagged packages, see TRICE_RING_CORES, held back for merging the core streams by target timestamp. 0 merges package by package. (default 256)
         -s    Short for '-showInputBytes'.
         -showID string
               Format string for displaying first trice ID at start of each line. Example: "debug:%7d ". Default is "". If several trices form a log line only the first trice ID ist displayed.
@@ -199,6 +209,10 @@ func _TestHelpAll(t *testing.T) {
         -til string
               Short for '-idlist'.
                (default "til.json")
+        -traceClock float
+              TRICE_FUNCTION_CLOCK frequency in MHz for the microsecond timestamps inside -traceFile. (default 1)
+        -traceFile string
+              Output file for the target function trace, see TRICE_FUNCTION_TRACE, in the Chrome trace event JSON format. Open it with https://ui.perfetto.dev. It is written at the end of a file input or on CTRL-C.
         -ts string
               PC timestamp for logs and logfile name, options: 'off|none|UTCmicro|zero'
               This timestamp switch generates the timestamps on the PC only (reception time), what is good enough for many cases.
@@ -308,6 +322,12 @@ func _TestHelpAll(t *testing.T) {
               You can specify this switch if you want to change the used port number for the remote display functionality.
                (default "61497")
       example: 'trice sd': Shut down remote display server.
+      sub-command 'spans': For profiling with the target TRICE_SPAN_BEGIN and TRICE_SPAN_END macros.
+              "trice spans" accepts the same switches as "trice log", but shows only the span statistics instead of the trice logs.
+              For each span name count, min, avg, max and 99th percentile in TRICE_SPAN_CLOCK ticks and a histogram are shown
+              at the end of a -port FILEBUFFER input or on CTRL-C. "trice log" shows them too, if the target sent spans.
+      example: 'trice spans -p J-LINK': Collect spans until CTRL-C.
+      example: 'trice spans -p FILEBUFFER -args trice.bin': Show the spans inside a binary log file.
       sub-command 'ver|version': For displaying version information.
               "trice v" will print the version information. If trice is not versioned the build time will be displayed instead.
         -logfile string
@@ -365,6 +385,8 @@ func _TestHelpAll(t *testing.T) {
         -til string
               Short for '-idlist'.
                (default "til.json")
+        -tilh string
+              C header file with channel, level and parameter size per ID, generated from the ID list, like "til.h". Empty means no header.
         -v    short for verbose
         -verbose
               Gives more informal output if used. Can be helpful during setup.
@@ -63,6 +63,7 @@ var (
 	renewHelp         bool // flag for partial help
 	scanHelp          bool // flag for partial help
 	shutdownHelp      bool // flag for partial help
+	spansHelp         bool // flag for partial help
 	updateHelp        bool // flag for partial help
 	versionHelp       bool // flag for partial help
 	zeroIDsHelp       bool // flag for partial help
@@ -5,10 +5,13 @@ package decoder
 
 import (
 	"bytes"
+	"encoding/binary"
 	"fmt"
 	"io"
+	"io/ioutil"
 	"log"
 	"math"
+	"path/filepath"
 	"strings"
 	"sync"
 	"unsafe"
@@ -22,10 +25,19 @@ import (
 // cobsDec is the Decoding instance for cobsDec encoded trices.
 type cobsDec struct {
 	decoderData
-	cycle              uint8  // cycle date: c0...bf
-	COBSModeDescriptor uint32 // 0: no target timestamps, 1: target timestamps exist
-	pFmt               string // modified trice format string: %u -> %d
-	u                  []int  // 1: modified format string positions:  %u -> %d, 2: float (%f)
+	cycle              uint8                           // cycle date: c0...bf
+	COBSModeDescriptor uint32                          // 0: no target timestamps, 1: target timestamps exist
+	packageTimestamp   uint32                          // delta timestamp mode: timestamp of the previous trice inside the package
+	preReset           bool                            // the package was written before the last target reset and is not labeled yet
+	fragments          map[uint32][]byte               // fragments holds the received data of unfinished fragmented transfers by trice ID and transfer id.
+	pFmt               string                          // modified trice format string: %u -> %d
+	u                  []int                           // 1: modified format string positions:  %u -> %d, 2: float (%f)
+	frameDecode        func(d, in []byte) (int, error) // frameDecode is the framing decoder: cobs.Decode or tcobs.Decode
+	stream             int                             // stream is 0 for untagged packages and core+1 for core tagged packages.
+	cycles             [257]uint8                      // cycles holds the cycle counters of the not selected streams as offset to 0xc0.
+	streams            map[int][]coreRecord            // streams holds the trices of the core tagged packages for the merge.
+	pending            int                             // pending is the trice count inside streams.
+	seq                uint64                          // seq counts the trices from core tagged packages.
 }
 
 // newCOBSDecoder provides a COBS decoder instance.
@@ -43,6 +55,8 @@ func newCOBSDecoder(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.Tr
 	p.lutMutex = m
 	p.li = li
 	p.endian = endian
+	p.frameDecode = cobs.Decode
+	p.fragments = make(map[uint32][]byte)
 	return p
 }
 
@@ -150,7 +164,27 @@ func dump(w io.Writer, b []byte) {
 // When a terminating 0 is found in the incoming bytes ReadFromCOBS decodes the COBS package
 // and returns it in b and its len in n. If more data arrived after the first terminating 0,
 // these are kept internally and concatenated with the following bytes in a next Read.
+//
+// Core tagged packages from targets with TRICE_RING_CORES > 1 are split into single trices, which are merged by target
+// timestamp with up to ReorderWindow trices held back. If no complete package is available, the held back trices follow.
 func (p *cobsDec) nextCOBSPackage() {
+	for p.pending <= ReorderWindow && p.decodeNextPackage() {
+		if p.COBSModeDescriptor&coreFlag == 0 {
+			p.selectStream(0)
+			return
+		}
+		if !p.splitPackage() { // no target timestamps, so no merge
+			p.selectStream(int(p.COBSModeDescriptor>>8&0xff) + 1)
+			return
+		}
+	}
+	if p.pending > 0 {
+		p.popRecord()
+	}
+}
+
+// decodeNextPackage reads and decodes the next COBS package into p.b and returns false, if there is no complete package.
+func (p *cobsDec) decodeNextPackage() bool {
 	// Here p.iBuf contains none or available bytes, what can be several trice messages.
 	// So first try to process p.iBuf.
 	index := bytes.IndexByte(p.iBuf, 0) // find terminating 0
@@ -165,7 +199,7 @@ func (p *cobsDec) nextCOBSPackage() {
 		if index == -1 {                   // p.iBuf has no complete COBS data, so leave
 			// Even err could be io.EOF, some valid data possibly in p.iBUf.
 			// In case of file input (J-LINK usage) a plug off is not detectable here.
-			return // no terminating 0, nothing to do
+			return false // no terminating 0, nothing to do
 		}
 	}
 	if TestTableMode {
@@ -178,7 +212,7 @@ func (p *cobsDec) nextCOBSPackage() {
 	}
 
 	p.b = make([]byte, defaultSize)
-	n, e := cobs.Decode(p.b, p.iBuf[:index])
+	n, e := p.frameDecode(p.b, p.iBuf[:index])
 	if e != nil {
 		fmt.Println("inconsistent COBS buffer:", p.iBuf[:index+1])
 	}
@@ -189,7 +223,7 @@ func (p *cobsDec) nextCOBSPackage() {
 		fmt.Fprintln(p.w, "ERROR:Decoded trice COBS package has not expected  multiple of 4 len. The len is", n) // exit
 		n = 0
 		p.b = p.b[:0]
-		return
+		return true
 	}
 
 	if DebugOut { // Debug output
@@ -197,7 +231,14 @@ func (p *cobsDec) nextCOBSPackage() {
 		dump(p.w, p.b)
 	}
 
-	if cipher.Password != "" { // encrypted
+	if cipher.Password != "" && cipher.Mode == "CTR" { // encrypted in counter mode
+		n = cipher.DecryptCTR(p.b, p.b)
+		p.b = p.b[:n]
+		if DebugOut { // Debug output
+			fmt.Fprint(p.w, "-> DEC:  ")
+			dump(p.w, p.b)
+		}
+	} else if cipher.Password != "" { // encrypted
 		cipher.Decrypt(p.b, p.b)
 		if DebugOut { // Debug output
 			fmt.Fprint(p.w, "-> DEC:  ")
@@ -209,10 +250,16 @@ func (p *cobsDec) nextCOBSPackage() {
 		p.COBSModeDescriptor = p.readU32(p.b)
 		p.b = p.b[4:] // drop COBS package descriptor
 	}
+	p.preReset = p.COBSModeDescriptor&16 != 0
+	if p.COBSModeDescriptor&4 != 0 && len(p.b) >= 4 { // delta timestamps
+		p.packageTimestamp = p.readU32(p.b)
+		p.b = p.b[4:] // drop absolute package timestamp
+	}
+	return true
 }
 
 func (p *cobsDec) handleCOBSModeDescriptor() error {
-	switch p.COBSModeDescriptor {
+	switch p.COBSModeDescriptor &^ (8 | 16 | 32 | coreFlag | 0xff00) { // bit 3 marks packed parameters, bit 4 packages from before a target reset, bit 5 urgent packages, bit 6 the core number in bits 15...8
 	case 0: // nothing to do
 		targetTimestampExists = false
 		targetLocationExists = false
@@ -236,12 +283,38 @@ func (p *cobsDec) handleCOBSModeDescriptor() error {
 		targetLocationExists = true
 		p.b = p.b[8:] // drop target location & timestamp
 		return nil
+	case 5:
+		targetTimestamp = p.deltaTimestamp()
+		targetTimestampExists = true
+		targetLocationExists = false
+		return nil
+	case 7:
+		targetLocation = p.readU32(p.b)
+		p.b = p.b[4:] // drop target location
+		targetTimestamp = p.deltaTimestamp()
+		targetTimestampExists = true
+		targetLocationExists = true
+		return nil
 	}
 	err := fmt.Errorf("Info:Unknown COBS packet with descriptor 0x%08x and len %d \n(((as ASCII:\"%s\")))", p.COBSModeDescriptor, len(p.b), string(p.b))
 	p.b = p.b[:0] // clear buffer
 	return err
 }
 
+// deltaTimestamp reads the 16- or 32-bit timestamp delta in front of a trice and returns the absolute timestamp.
+//
+// A delta with bit 15 set in the first 16-bit unit is a signed 31-bit delta, so the timestamp can step backwards.
+func (p *cobsDec) deltaTimestamp() uint32 {
+	d := uint32(p.readU16(p.b))
+	p.b = p.b[2:]
+	if d&0x8000 != 0 {
+		d = uint32(int32((d&0x7fff)<<17|uint32(p.readU16(p.b))<<1) >> 1) // sign extension of bit 30
+		p.b = p.b[2:]
+	}
+	p.packageTimestamp += d
+	return p.packageTimestamp
+}
+
 // Read is the provided read method for COBS decoding and provides next string as byte slice.
 //
 // It uses inner reader p.in and internal id look-up table to fill b with a string.
@@ -264,6 +337,9 @@ func (p *cobsDec) Read(b []byte) (n int, err error) {
 	if targetLocationExists {
 		minPkgSize += 4
 	}
+	if p.COBSModeDescriptor&4 != 0 && minPkgSize > headSize+2 { // a delta timestamp can have only 2 bytes
+		minPkgSize -= 2
+	}
 	if len(p.b) < minPkgSize { // last decoded COBS package exhausted
 		p.nextCOBSPackage()
 	}
@@ -282,34 +358,54 @@ func (p *cobsDec) Read(b []byte) (n int, err error) {
 		n += copy(b[n:], fmt.Sprintln(err))
 		return // ignore package
 	}
+	if p.preReset { // retained in target no-init RAM over a reset
+		n += copy(b[n:], fmt.Sprintln("wrn:Trices from before the last target reset:"))
+		p.preReset = false
+	}
 	head := p.readU32(p.b)
+	if head&0xff00 == 0xff00 { // reserved length byte 0xFF: target control record without cycle counter
+		n += p.controlRecord(b[n:], head)
+		return
+	}
+	if p.COBSModeDescriptor&8 != 0 && head&0x8000 != 0 { // zigzag varint packed parameters
+		if err = p.unpackParams(head); err != nil {
+			n += copy(b[n:], fmt.Sprintln(err))
+			p.b = p.b[:0]
+			return // ignore package
+		}
+		head &^= 0x8000
+	}
 
 	// cycle counter automatic & check
 	cycle := uint8(head)
-	if cycle == 0xc0 && p.cycle != 0xc0 && initialCycle { // with cycle counter and seems to be a target reset
-		n += copy(b[n:], fmt.Sprintln("warning:   Target Reset?   "))
-		p.cycle = cycle + 1 // adjust cycle
-		initialCycle = false
-	}
-	if cycle == 0xc0 && p.cycle != 0xc0 && !initialCycle { // with cycle counter and seems to be a target reset
-		//n += copy(b[n:], fmt.Sprintln("info:   Target Reset?   ")) // todo: This line is ok with cycle counter but not without cycle counter
-		p.cycle = cycle + 1 // adjust cycle
-	}
-	if cycle == 0xc0 && p.cycle == 0xc0 && initialCycle { // with or without cycle counter and seems to be a target reset
-		//n += copy(b[n:], fmt.Sprintln("warning:   Restart?   "))
-		p.cycle = cycle + 1 // adjust cycle
-		initialCycle = false
-	}
-	if cycle == 0xc0 && p.cycle == 0xc0 && !initialCycle { // with or without cycle counter and seems to be a normal case
-		p.cycle = cycle + 1 // adjust cycle
-	}
-	if cycle != 0xc0 { // with cycle counter and s.th. lost
-		if cycle != p.cycle { // no cycle check for 0xc0 to avoid messages on every target reset and when no cycle counter is active
-			n += copy(b[n:], fmt.Sprintln("CYCLE:", cycle, "not equal expected value", p.cycle, "- adjusting. Now", emitter.ColorChannelEvents("CYCLE")+1, "CycleEvents"))
-			p.cycle = cycle // adjust cycle
+	if p.COBSModeDescriptor&32 == 0 { // urgent trices overtake the others and do not advance the target cycle counter
+		if cycle == 0xc0 && p.cycle != 0xc0 && initialCycle { // with cycle counter and seems to be a target reset
+			n += copy(b[n:], fmt.Sprintln("warning:   Target Reset?   "))
+			p.cycle = cycle + 1 // adjust cycle
+			initialCycle = false
+		}
+		if cycle == 0xc0 && p.cycle != 0xc0 && !initialCycle { // with cycle counter and seems to be a target reset
+			//n += copy(b[n:], fmt.Sprintln("info:   Target Reset?   ")) // todo: This line is ok with cycle counter but not without cycle counter
+			p.cycle = cycle + 1 // adjust cycle
+		}
+		if cycle == 0xc0 && p.cycle == 0xc0 && initialCycle { // with or without cycle counter and seems to be a target reset
+			//n += copy(b[n:], fmt.Sprintln("warning:   Restart?   "))
+			p.cycle = cycle + 1 // adjust cycle
+			initialCycle = false
+		}
+		if cycle == 0xc0 && p.cycle == 0xc0 && !initialCycle { // with or without cycle counter and seems to be a normal case
+			p.cycle = cycle + 1 // adjust cycle
+		}
+		if cycle != 0xc0 { // with cycle counter and s.th. lost
+			if cycle != p.cycle { // no cycle check for 0xc0 to avoid messages on every target reset and when no cycle counter is active
+				if p.COBSModeDescriptor&16 == 0 { // packages from before a target reset follow older packages
+					n += copy(b[n:], fmt.Sprintln("CYCLE:", cycle, "not equal expected value", p.cycle, "- adjusting. Now", emitter.ColorChannelEvents("CYCLE")+1, "CycleEvents"))
+				}
+				p.cycle = cycle // adjust cycle
+			}
+			initialCycle = false
+			p.cycle++
 		}
-		initialCycle = false
-		p.cycle++
 	}
 
 	p.paramSpace = int((0x0000FF00 & head) >> 6)
@@ -358,9 +454,92 @@ func (p *cobsDec) Read(b []byte) (n int, err error) {
 	return
 }
 
+// unpackParams replaces the zigzag varints behind head in p.b with the 32-bit words they encode.
+//
+// The head length byte without bit 7 is the unpacked word count. Afterwards p.b looks like an unpacked trice.
+func (p *cobsDec) unpackParams(head uint32) error {
+	count := int(head>>8) & 0x7f
+	u := make([]byte, headSize+4*count)
+	p.writeU32(u, head&^0x8000)
+	i := headSize
+	for k := 0; k < count; k++ {
+		z, m := binary.Uvarint(p.b[i:])
+		if m <= 0 || z > math.MaxUint32 {
+			return fmt.Errorf("ERROR:invalid packed parameter %d in %v", k, p.b)
+		}
+		i += m
+		p.writeU32(u[headSize+4*k:], uint32(z>>1)^-uint32(z&1)) // zigzag decoding
+	}
+	p.b = append(u, p.b[i:]...)
+	return nil
+}
+
+// controlLost is the type of the control record the target sends after dropping trices.
+// Its value is the count of lost trices and its payload word the count of lost bytes.
+const controlLost = 1
+
+// controlSuppressed is the type of the control record the target sends in front of a trice, after the rate limit suppressed trices.
+// Its value is the count of suppressed trices and its payload word the trice ID allowed again.
+const controlSuppressed = 2
+
+// controlSpanBegin is the type of the control record TRICE_SPAN_BEGIN.
+// Its value is the span ID and its payload word the target TRICE_SPAN_CLOCK() value.
+const controlSpanBegin = 3
+
+// controlSpanEnd is the type of the control record TRICE_SPAN_END with the same value and payload as controlSpanBegin.
+const controlSpanEnd = 4
+
+// controlFunctionEnter is the type of the control record the target hook __cyg_profile_func_enter sends.
+// Its value is the lower half of the target clock value and its payload word the function address. A 64-bit address takes 2 words with the lower half first.
+const controlFunctionEnter = 5
+
+// controlFunctionExit is the type of the control record the target hook __cyg_profile_func_exit sends with the same value and payload as controlFunctionEnter.
+const controlFunctionExit = 6
+
+// controlRecord handles a target control record with head, writes its message into b and returns that len.
+//
+// A control record head has the reserved length byte 0xFF. The upper 16 bits are a value,
+// the lowest byte contains the type in bits 7..2 and the payload word count in bits 1..0.
+func (p *cobsDec) controlRecord(b []byte, head uint32) (n int) {
+	typ := (head >> 2) & 0x3f
+	value := head >> 16
+	size := headSize + 4*int(head&3)
+	if len(p.b) < size {
+		n += copy(b[n:], fmt.Sprintln("ERROR:package len", len(p.b), "is <", size, " - ignoring package", p.b))
+		n += copy(b[n:], fmt.Sprintln(hints))
+		p.b = p.b[len(p.b):]
+		return
+	}
+	switch {
+	case typ == controlLost && size == headSize+4:
+		n += copy(b[n:], fmt.Sprintln("LOST:", value, "trices with", p.readU32(p.b[4:]), "bytes dropped on target. Now", emitter.ColorChannelEvents("LOST")+1, "LostEvents"))
+		spansLost()
+	case typ == controlSuppressed && size == headSize+4:
+		n += copy(b[n:], fmt.Sprintln("wrn:", value, "trices suppressed on target by the rate limit. ID", p.readU32(p.b[4:]), "is sending again."))
+	case typ == controlSpanBegin && size == headSize+4:
+		spanBegin(p.spanName(id.TriceID(value)), p.stream, p.readU32(p.b[4:]))
+	case typ == controlSpanEnd && size == headSize+4:
+		name := p.spanName(id.TriceID(value))
+		if !spanEnd(name, p.stream, p.readU32(p.b[4:])) {
+			n += copy(b[n:], fmt.Sprintln("wrn:span", name, "ends without begin - ignoring"))
+		}
+	case (typ == controlFunctionEnter || typ == controlFunctionExit) && size == headSize+4:
+		functionTraceEvent(p.stream, typ == controlFunctionEnter, uint64(p.readU32(p.b[4:])), uint16(value))
+	case (typ == controlFunctionEnter || typ == controlFunctionExit) && size == headSize+8:
+		functionTraceEvent(p.stream, typ == controlFunctionEnter, uint64(p.readU32(p.b[4:]))|uint64(p.readU32(p.b[8:]))<<32, uint16(value))
+	default:
+		n += copy(b[n:], fmt.Sprintln("WARNING:unknown control record type", typ, "- ignoring", p.b[:size]))
+	}
+	p.b = p.b[size:]
+	return
+}
+
 // sprintTrice writes a trice string or appropriate message into b and returns that len.
 func (p *cobsDec) sprintTrice(b []byte) (n int) {
 
+	if (p.trice.Type == "TRICE_S" || p.trice.Type == "TRICE_N") && len(p.b) >= 4 && p.readU32(p.b)&0x80000000 != 0 {
+		return p.fragment(b)
+	}
 	if p.trice.Type == "TRICE_S" { // patch table paramSpace in that case
 		p.sLen = int(p.readU32(p.b))
 		cobsFunctionPtrList[0].paramSpace = (p.sLen + 7) & ^3 // +4 for 4 bytes sLen, +3^3 is alignment to 4
@@ -370,6 +549,10 @@ func (p *cobsDec) sprintTrice(b []byte) (n int) {
 		cobsFunctionPtrList[1].paramSpace = (p.sLen + 7) & ^3 // +4 for 4 bytes sLen, +3^3 is alignment to 4
 	}
 
+	if p.trice.Type == "TRICE_M" { // patch table paramSpace in that case, triceM checks the parameter widths
+		cobsFunctionPtrList[2].paramSpace = p.paramSpace
+	}
+
 	p.pFmt, p.u = uReplaceN(p.trice.Strg)
 
 	var triceType string                           // need to reconstruct full TRICE info, if not exist in type string
@@ -408,6 +591,47 @@ func (p *cobsDec) sprintTrice(b []byte) (n int) {
 	return
 }
 
+// fragment collects a fragment of a buffer streamed by the target function TriceFragments.
+//
+// The length word has bit 31 set, bit 30 marks the last fragment, bits 23..16 are the transfer id and bits 15..0 the fragment byte count.
+// The next word is the fragment byte offset. On the last fragment the reassembled buffer is written into
+// a file inside FragmentDir or, if FragmentDir is empty, formatted with the trice format string.
+// Other fragments give no output.
+func (p *cobsDec) fragment(b []byte) (n int) {
+	length := p.readU32(p.b)
+	count := int(length & 0xffff)
+	if p.paramSpace != (count+11)&^3 || len(p.b) < p.paramSpace {
+		n += copy(b[n:], fmt.Sprintln("err:invalid fragment of ID", lastTriceID, "- ignoring data", p.b))
+		return
+	}
+	key := uint32(lastTriceID)<<8 | (length>>16)&0xff
+	offset := int(p.readU32(p.b[4:]))
+	data := p.fragments[key]
+	if offset == 0 {
+		data = data[:0] // a new transfer, maybe the transfer id wrapped
+	}
+	if offset != len(data) {
+		n += copy(b[n:], fmt.Sprintln("wrn:fragment of ID", lastTriceID, "at offset", offset, "but", len(data), "bytes received - ignoring transfer"))
+		delete(p.fragments, key)
+		return
+	}
+	data = append(data, p.b[8:8+count]...)
+	if length&0x40000000 == 0 {
+		p.fragments[key] = data
+		return
+	}
+	delete(p.fragments, key)
+	if FragmentDir == "" {
+		return copy(b, fmt.Sprintf(p.trice.Strg, string(data)))
+	}
+	fragmentFiles++
+	fn := filepath.Join(FragmentDir, fmt.Sprintf("trice_%d_%d.bin", lastTriceID, fragmentFiles))
+	if err := ioutil.WriteFile(fn, data, 0644); err != nil {
+		return copy(b, fmt.Sprintln("err:", err))
+	}
+	return copy(b, fmt.Sprintln("info:", len(data), "bytes from ID", lastTriceID, "written to", fn))
+}
+
 // triceTypeFn is the type for cobsFunctionPtrList elements.
 type triceTypeFn struct {
 	triceType  string                                              // triceType describes if parameters, the parameter bit width or if the parameter is a string.
@@ -421,6 +645,7 @@ type triceTypeFn struct {
 var cobsFunctionPtrList = [...]triceTypeFn{
 	{"TRICE_S", (*cobsDec).triceS, -1, 0, 0}, // do not remove from first position, see cobsFunctionPtrList[0].paramSpace = ...
 	{"TRICE_N", (*cobsDec).triceN, -1, 0, 0}, // do not remove from 2nd position, see cobsFunctionPtrList[1].paramSpace = ...
+	{"TRICE_M", (*cobsDec).triceM, -1, 0, 0}, // do not remove from 3rd position, see cobsFunctionPtrList[2].paramSpace = ...
 	{"TRICE32_0", (*cobsDec).trice0, 0, 0, 0},
 	{"TRICE0", (*cobsDec).trice0, 0, 0, 0},
 	{"TRICE8_1", (*cobsDec).unSignedOrSignedOut, 4, 8, 1},
@@ -492,6 +717,75 @@ func (p *cobsDec) triceN(b []byte, _ int, _ int) int {
 	return copy(b, fmt.Sprintf(p.trice.Strg, string(s)))
 }
 
+// hexPointers returns f with each %p replaced by %#x, which prints an integer target address like fmt prints a pointer.
+func hexPointers(f string) string {
+	parts := strings.Split(f, "%%")
+	for i := range parts {
+		parts[i] = strings.Replace(parts[i], "%p", "%#x", -1)
+	}
+	return strings.Join(parts, "%%")
+}
+
+// triceM converts the mixed bit width parameters written by the C++ TRICE_M.
+//
+// The first payload word carries the parameter count in bits 31..24 and 2 bits for each
+// parameter starting with bits 1..0: 0 is 8, 1 is 16, 2 is 32 and 3 is 64 bit.
+// The parameters follow without padding.
+func (p *cobsDec) triceM(b []byte, _ int, _ int) int {
+	if p.paramSpace < 4 {
+		return copy(b, fmt.Sprintln("err:TRICE_M without width descriptor - ignoring data", p.b[:p.paramSpace]))
+	}
+	desc := p.readU32(p.b)
+	if int(desc>>24) != len(p.u) {
+		return copy(b, fmt.Sprintln("ERROR: Invalid format specifier count inside", p.trice.Type, p.trice.Strg))
+	}
+	v := make([]interface{}, len(p.u))
+	offset := 4
+	for i, f := range p.u {
+		bitwidth := 8 << (desc >> (2 * uint(i)) & 3)
+		if offset+bitwidth/8 > p.paramSpace {
+			return copy(b, fmt.Sprintln("err:TRICE_M parameters exceed the payload - ignoring data", p.b[:p.paramSpace]))
+		}
+		var n uint64
+		switch bitwidth {
+		case 8:
+			n = uint64(p.b[offset])
+		case 16:
+			n = uint64(p.readU16(p.b[offset:]))
+		case 32:
+			n = uint64(p.readU32(p.b[offset:]))
+		case 64:
+			n = p.readU64(p.b[offset:])
+		}
+		offset += bitwidth / 8
+		switch f {
+		case 0:
+			v[i] = n
+		case 1: // sign extension
+			v[i] = int64(n<<(64-uint(bitwidth))) >> (64 - uint(bitwidth))
+		case 2:
+			switch bitwidth {
+			case 32:
+				v[i] = math.Float32frombits(uint32(n))
+			case 64:
+				v[i] = math.Float64frombits(n)
+			default:
+				return copy(b, fmt.Sprintln("ERROR: Invalid format specifier (float?) inside", p.trice.Type, p.trice.Strg))
+			}
+		case 3:
+			v[i] = n != 0
+		case 4:
+			v[i] = n // printed with hexPointers
+		default:
+			return copy(b, fmt.Sprintln("ERROR: Invalid format specifier inside", p.trice.Type, p.trice.Strg))
+		}
+	}
+	if (offset+3)&^3 != p.paramSpace {
+		return copy(b, fmt.Sprintln("err:TRICE_M parameters do not fill the payload - ignoring data", p.b[:p.paramSpace]))
+	}
+	return copy(b, fmt.Sprintf(hexPointers(p.pFmt), v...))
+}
+
 // trice0 prints the trice format string.
 func (p *cobsDec) trice0(b []byte, _ int, _ int) int {
 	return copy(b, fmt.Sprintf(p.trice.Strg))
@@ -9,6 +9,7 @@ import (
 	"io"
 	"io/ioutil"
 	"os"
+	"path/filepath"
 	"strings"
 	"sync"
 	"testing"
@@ -211,3 +212,413 @@ COBS: 00
 COBS: 00
 -> PKG:
 */
+
+// TestCOBSLostRecord checks a LOST control record behind a trice.
+func TestCOBSLostRecord(t *testing.T) {
+	tt := testTable{ // little endian: descriptor, trice, control record 0x0003ff05 with payload 24
+		{[]byte{0x01, 0x01, 0x01, 0x01, 0x06, 0xc0, 0x01, 0x83, 0xe5, 0x07, 0x01, 0x01, 0x04, 0x05, 0xff, 0x03, 0x02, 0x18, 0x01, 0x01, 0x01, 0x00}, `rd:TRICE32_1 line 7 (%d)\nLOST: 3 trices with 24 bytes dropped on target. Now 1 LostEvents`},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSSuppressedRecord checks a SUPPRESSED control record in front of a trice.
+func TestCOBSSuppressedRecord(t *testing.T) {
+	tt := testTable{ // little endian: descriptor, control record 0x0011ff09 with payload 58755, trice
+		{[]byte{0x01, 0x01, 0x01, 0x01, 0x04, 0x09, 0xff, 0x11, 0x03, 0x83, 0xe5, 0x01, 0x06, 0xc0, 0x01, 0x83, 0xe5, 0x07, 0x01, 0x01, 0x01, 0x00}, "wrn: 17 trices suppressed on target by the rate limit. ID 58755 is sending again.\nrd:TRICE32_1 line 7 (%d)"},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSPreResetPackage checks the label and the missing cycle warning for a package from before a target reset.
+func TestCOBSPreResetPackage(t *testing.T) {
+	tt := testTable{ // little endian: descriptor 16, trices with cycles 0x57 and 0x58
+		{[]byte{0x02, 0x10, 0x01, 0x01, 0x06, 0x57, 0x01, 0x83, 0xe5, 0x02, 0x01, 0x01, 0x06, 0x58, 0x01, 0x83, 0xe5, 0x03, 0x01, 0x01, 0x01, 0x00}, "wrn:Trices from before the last target reset:\nrd:TRICE32_1 line 2 (%d)\\nrd:TRICE32_1 line 3 (%d)"},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSUrgentPackage checks, that an urgent package does not disturb the cycle counter check.
+func TestCOBSUrgentPackage(t *testing.T) {
+	tt := testTable{ // little endian: descriptor 32 with cycle 0x45, then descriptor 0 with cycles 0xc0 and 0xc1
+		{[]byte{0x02, 0x20, 0x01, 0x01, 0x06, 0x45, 0x01, 0x83, 0xe5, 0x09, 0x01, 0x01, 0x01, 0x00}, `rd:TRICE32_1 line 9 (%d)`},
+		{[]byte{0x01, 0x01, 0x01, 0x01, 0x06, 0xc0, 0x01, 0x83, 0xe5, 0x01, 0x01, 0x01, 0x06, 0xc1, 0x01, 0x83, 0xe5, 0x02, 0x01, 0x01, 0x01, 0x00}, `rd:TRICE32_1 line 1 (%d)\nrd:TRICE32_1 line 2 (%d)`},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSPackedParams checks zigzag varint packed parameters in COBS package mode 8.
+func TestCOBSPackedParams(t *testing.T) {
+	tt := testTable{ // little endian: descriptor 8, packed 7 and -3, unpacked 0x12345678, packed 150
+		{[]byte{0x02, 0x08, 0x01, 0x01, 0x19, 0xc0, 0x81, 0x83, 0xe5, 0x0e, 0xc1, 0x81, 0x83, 0xe5, 0x05, 0xc2, 0x01, 0x83, 0xe5, 0x78, 0x56, 0x34, 0x12, 0xc3, 0x81, 0x83, 0xe5, 0xac, 0x02, 0x00}, `rd:TRICE32_1 line 7 (%d)\nrd:TRICE32_1 line -3 (%d)\nrd:TRICE32_1 line 305419896 (%d)\nrd:TRICE32_1 line 150 (%d)`},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSDeltaTimestamps checks the timestamp reconstruction in COBS package mode 5.
+func TestCOBSDeltaTimestamps(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"58755": {"Type": "TRICE32_1", "Strg": "rd:TRICE32_1 line %d (%%d)\\n"}}`)))
+	lu.AddFmtCount(os.Stdout)
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	// little endian: descriptor 5, package timestamp 0x1000, 4 trices with deltas 0, 0x12345 (32-bit), 0x10, 5 and 2 padding bytes
+	in := []byte{0x02, 0x05, 0x01, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01, 0x01, 0x06, 0xc0, 0x01, 0x83, 0xe5, 0x07, 0x01, 0x01, 0x0a, 0x01, 0x80, 0x45, 0x23, 0xc1, 0x01, 0x83, 0xe5, 0x08, 0x01, 0x01, 0x02, 0x10, 0x06, 0xc2, 0x01, 0x83, 0xe5, 0x09, 0x01, 0x01, 0x02, 0x05, 0x06, 0xc3, 0x01, 0x83, 0xe5, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00}
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for {
+		n, _ := dec.Read(buf)
+		if n == 0 {
+			break
+		}
+		act += fmt.Sprintf("%x:%s|", targetTimestamp, buf[:n])
+	}
+	assert.Equal(t, `1000:rd:TRICE32_1 line 7 (%d)\n|13345:rd:TRICE32_1 line 8 (%d)\n|13355:rd:TRICE32_1 line 9 (%d)\n|1335a:rd:TRICE32_1 line 10 (%d)\n|`, act)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSDeltaTimestampBackwards checks a signed 31-bit delta for a timestamp stepping backwards.
+func TestCOBSDeltaTimestampBackwards(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"58755": {"Type": "TRICE32_1", "Strg": "rd:TRICE32_1 line %d (%%d)\\n"}}`)))
+	lu.AddFmtCount(os.Stdout)
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	// package timestamp 0x1000, 2 trices with deltas 0 and -0x10 (0xffff 0xfff0) and 2 padding bytes
+	in := cobsPackage(5, 0x1000, 0x01c00000, 0x0007e583, 0xffff0000, 0x01c1fff0, 0x0008e583, 0)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for {
+		n, _ := dec.Read(buf)
+		if n == 0 {
+			break
+		}
+		act += fmt.Sprintf("%x:%s|", targetTimestamp, buf[:n])
+	}
+	assert.Equal(t, `1000:rd:TRICE32_1 line 7 (%d)\n|ff0:rd:TRICE32_1 line 8 (%d)\n|`, act)
+	assert.Equal(t, "", out.String())
+}
+
+// TestCOBSFragments checks the reassembly of a buffer streamed by the target in fragments.
+func TestCOBSFragments(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1201": {"Type": "TRICE_N", "Strg": "msg:%s\\n"}}`)))
+	lu.AddFmtCount(os.Stdout)
+	// little endian: transfer 5 with "Hello, " at offset 0 and the last fragment "world!" at offset 7, transfer 6 without its first fragment
+	in := []byte{
+		0x01, 0x01, 0x01, 0x01, 0x06, 0xc0, 0x04, 0xb1, 0x04, 0x07, 0x03, 0x05, 0x80, 0x01, 0x01, 0x01, 0x08, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0xc1, 0x04, 0xb1, 0x04, 0x06, 0x04, 0x05, 0xc0, 0x07, 0x01, 0x01, 0x07, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0xc2, 0x03, 0xb1, 0x04, 0x04, 0x04, 0x06, 0x80, 0x04, 0x01, 0x01, 0x05, 0x61, 0x62, 0x63, 0x64, 0x00,
+	}
+	read := func() (act string) {
+		var out bytes.Buffer
+		dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+		dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+		buf := make([]byte, defaultSize)
+		for i := 0; i < 4; i++ { // a not last fragment gives no output
+			n, _ := dec.Read(buf)
+			act += string(buf[:n])
+		}
+		assert.Equal(t, "", out.String())
+		return
+	}
+	assert.Equal(t, `msg:Hello, world!\n`+"wrn:fragment of ID 1201 at offset 4 but 0 bytes received - ignoring transfer\n", read())
+
+	dir, err := ioutil.TempDir("", "fragments")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	FragmentDir = dir
+	defer func() { FragmentDir = "" }()
+	fn := filepath.Join(dir, fmt.Sprintf("trice_1201_%d.bin", fragmentFiles+1))
+	assert.Equal(t, "info: 13 bytes from ID 1201 written to "+fn+"\n"+"wrn:fragment of ID 1201 at offset 4 but 0 bytes received - ignoring transfer\n", read())
+	b, err := ioutil.ReadFile(fn)
+	assert.Nil(t, err)
+	assert.Equal(t, "Hello, world!", string(b))
+}
+
+// TestCOBSMixed checks the decoding of the C++ TRICE_M with its parameter width descriptor.
+func TestCOBSMixed(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1501": {"Type": "TRICE_M", "Strg": "msg:%d %u %f %f %t\n"}, "1502": {"Type": "TRICE_M", "Strg": "msg:no parameters\n"}}`)))
+	lu.AddFmtCount(os.Stdout)
+	// little endian: int8_t -2, uint32_t 7, float 1.5, double 2.5, true and a TRICE_M without parameters
+	in := []byte{
+		0x01, 0x01, 0x01, 0x01, 0x06, 0xc0, 0x06, 0xdd, 0x05, 0xe8, 0x01, 0x04, 0x05, 0xfe, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0xc0, 0x3f,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x40, 0x01, 0x01, 0x05, 0xc1, 0x01, 0xde, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00,
+	}
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 2; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.Equal(t, "msg:-2 7 1.500000 2.500000 true\nmsg:no parameters\n", act)
+}
+
+// TestHexPointers checks, that a target address prints like a pointer.
+func TestHexPointers(t *testing.T) {
+	assert.Equal(t, "at 0x20001000 %p", fmt.Sprintf(hexPointers("at %p %%p"), uint64(0x20001000)))
+}
+
+// TestCOBSSpans checks the pairing of span begin and end records by name and the span statistics.
+func TestCOBSSpans(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1601": {"Type": "TRICE_SPAN_BEGIN", "Strg": "adc"}, "1602": {"Type": "TRICE_SPAN_END", "Strg": "adc"}}`)))
+	// little endian: adc 100..130, nested adc 200..300 and 210..260, an end of the unknown ID 1603
+	in := []byte{
+		0x01, 0x01, 0x01, 0x01, 0x06, 0x0d, 0xff, 0x41, 0x06, 0x64, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0x11, 0xff, 0x42, 0x06, 0x82, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0x0d, 0xff, 0x41, 0x06, 0xc8, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0x0d, 0xff, 0x41, 0x06, 0xd2, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x07, 0x11, 0xff, 0x42, 0x06, 0x04, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x07, 0x11, 0xff, 0x42, 0x06, 0x2c, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x06, 0x11, 0xff, 0x43, 0x06, 0x05, 0x01, 0x01, 0x01, 0x00,
+	}
+	spans = make(map[string]*span)
+	defer func() { spans = make(map[string]*span) }()
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 8; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.Equal(t, "wrn:span ID 1603 ends without begin - ignoring\n", act)
+
+	out.Reset()
+	PrintSpans(&out)
+	exp := `span                          count        min        avg        max        p99 (ticks)
+adc                               3         30         60        100        100
+                         16-31:1 32-63:1 64-127:1
+`
+	assert.Equal(t, exp, out.String())
+}
+
+// TestCOBSSpansLost checks, that a LOST record drops the open span begins, because the matching end can be lost.
+func TestCOBSSpansLost(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1601": {"Type": "TRICE_SPAN_BEGIN", "Strg": "adc"}, "1602": {"Type": "TRICE_SPAN_END", "Strg": "adc"}}`)))
+	// adc begin at 100 with its end lost, adc 200..230 and an adc end at 240 belonging to a begin before the loss
+	in := cobsFrame(0x0641ff0d, 100, 0x0641ff0d, 150)
+	in = append(in, cobsFrame(0x0001ff05, 8)...) // 1 trice with 8 bytes lost
+	in = append(in, cobsFrame(0x0641ff0d, 200, 0x0642ff11, 230, 0x0642ff11, 240)...)
+	spans = make(map[string]*span)
+	defer func() { spans = make(map[string]*span) }()
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 8; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.True(t, strings.HasPrefix(act, "LOST: 1 trices with 8 bytes dropped on target."))
+	assert.True(t, strings.HasSuffix(act, "wrn:span adc ends without begin - ignoring\n"))
+	assert.Equal(t, []uint32{30}, spans["adc"].ticks)
+}
+
+// TestCOBSSpansCores checks, that the same span running interleaved on 2 cores pairs per core.
+func TestCOBSSpansCores(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1601": {"Type": "TRICE_SPAN_BEGIN", "Strg": "adc"}, "1602": {"Type": "TRICE_SPAN_END", "Strg": "adc"}}`)))
+	// adc on core 0 from 100 to 200 and on core 1 from 150 to 260
+	in := cobsPackage(coreFlag|0<<8, 0x0641ff0d, 100)
+	in = append(in, cobsPackage(coreFlag|1<<8, 0x0641ff0d, 150)...)
+	in = append(in, cobsPackage(coreFlag|0<<8, 0x0642ff11, 200)...)
+	in = append(in, cobsPackage(coreFlag|1<<8, 0x0642ff11, 260)...)
+	spans = make(map[string]*span)
+	defer func() { spans = make(map[string]*span) }()
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 8; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.Equal(t, "", act)
+	assert.Equal(t, []uint32{100, 110}, spans["adc"].ticks)
+}
+
+// cobsFrame returns the COBS encoded package with a zero package descriptor and words in little endian, delimited by a 0.
+func cobsFrame(words ...uint32) []byte {
+	return cobsPackage(0, words...)
+}
+
+// cobsPackage returns the COBS encoded package with descriptor and words in little endian, delimited by a 0.
+func cobsPackage(descriptor uint32, words ...uint32) (frame []byte) {
+	raw := make([]byte, 0, 4+4*len(words))
+	for _, w := range append([]uint32{descriptor}, words...) {
+		raw = append(raw, byte(w), byte(w>>8), byte(w>>16), byte(w>>24))
+	}
+	for len(raw) > 0 {
+		i := bytes.IndexByte(raw, 0)
+		if i < 0 {
+			i = len(raw)
+		}
+		frame = append(frame, byte(i+1))
+		frame = append(frame, raw[:i]...)
+		if i == len(raw) {
+			break
+		}
+		raw = raw[i+1:]
+		if len(raw) == 0 {
+			frame = append(frame, 1)
+		}
+	}
+	return append(frame, 0)
+}
+
+// TestCOBSFunctionTrace checks the function trace from lower clock halves with a wrap, an interrupted event and a 64-bit address.
+func TestCOBSFunctionTrace(t *testing.T) {
+	dir, err := ioutil.TempDir("", "functrace")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	TraceFile = filepath.Join(dir, "trace.json")
+	FlameFile = filepath.Join(dir, "flame.txt")
+	TraceClock = 2
+	functionEvents, functionClocks, functionLast = nil, nil, nil
+	defer func() { TraceFile, FlameFile, functionEvents, functionClocks, functionLast = "", "", nil, nil, nil }()
+	base := uint32(0xfff6) // the clock wraps after f entry
+	head := func(typ, clock, words uint32) uint32 { return (base+clock)<<16 | 0xff00 | typ<<2 | words }
+	var in []byte
+	in = append(in, cobsFrame(head(controlFunctionEnter, 0, 1), 0x08000101)...)        // main at 0
+	in = append(in, cobsFrame(head(controlFunctionEnter, 12, 1), 0x08000501)...)       // isr at 12 interrupting the f entry
+	in = append(in, cobsFrame(head(controlFunctionExit, 22, 1), 0x08000501)...)        // isr at 22
+	in = append(in, cobsFrame(head(controlFunctionEnter, 10, 1), 0x08000201)...)       // f at 10
+	in = append(in, cobsFrame(head(controlFunctionExit, 40, 1), 0x08000201)...)        // f at 40
+	in = append(in, cobsFrame(head(controlFunctionExit, 40, 1), 0x08000401)...)        // exit without entry at 40
+	in = append(in, cobsFrame(head(controlFunctionEnter, 30040, 2), 0x08000301, 1)...) // g with 64-bit address at 30040
+	in = append(in, cobsFrame(head(controlFunctionExit, 30140, 2), 0x08000301, 1)...)  // g at 30140
+	in = append(in, cobsFrame(head(controlFunctionExit, 60000, 1), 0x08000101)...)     // main at 60000
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, make(id.TriceIDLookUp), new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 10; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.Equal(t, "", act)
+	assert.Equal(t, 9, len(functionEvents))
+
+	out.Reset()
+	WriteFunctionTrace(&out)
+	assert.Equal(t, "info: 9 function events written to "+TraceFile+"\ninfo: 4 call stacks written to "+FlameFile+"\n", out.String())
+	flame, err := ioutil.ReadFile(FlameFile)
+	assert.Nil(t, err)
+	assert.Equal(t, "0x08000101 59860\n0x08000101;0x08000201 30\n0x08000101;0x08000501 10\n0x08000101;0x108000301 100\n", string(flame))
+	trace, err := ioutil.ReadFile(TraceFile)
+	assert.Nil(t, err)
+	exp := `{"traceEvents":[` +
+		`{"name":"0x08000101","ph":"B","ts":0,"pid":1,"tid":1},` +
+		`{"name":"0x08000501","ph":"B","ts":6,"pid":1,"tid":1},` +
+		`{"name":"0x08000501","ph":"E","ts":11,"pid":1,"tid":1},` +
+		`{"name":"0x08000201","ph":"B","ts":5,"pid":1,"tid":1},` +
+		`{"name":"0x08000201","ph":"E","ts":20,"pid":1,"tid":1},` +
+		`{"name":"0x108000301","ph":"B","ts":15020,"pid":1,"tid":1},` +
+		`{"name":"0x108000301","ph":"E","ts":15070,"pid":1,"tid":1},` +
+		`{"name":"0x08000101","ph":"E","ts":30000,"pid":1,"tid":1}]}`
+	assert.Equal(t, exp, string(trace))
+}
+
+// TestCOBSFunctionTraceCores checks that the same function running on 2 cores has a call stack and a Chrome thread per core.
+func TestCOBSFunctionTraceCores(t *testing.T) {
+	dir, err := ioutil.TempDir("", "functrace")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	TraceFile = filepath.Join(dir, "trace.json")
+	FlameFile = filepath.Join(dir, "flame.txt")
+	TraceClock = 1
+	functionEvents, functionClocks, functionLast = nil, nil, nil
+	defer func() { TraceFile, FlameFile, functionEvents, functionClocks, functionLast = "", "", nil, nil, nil }()
+	// f on core 0 from 100 to 200 and on core 1 from 150 to 260
+	in := cobsPackage(coreFlag|0<<8, 100<<16|0xff15, 0x08000201)
+	in = append(in, cobsPackage(coreFlag|1<<8, 150<<16|0xff15, 0x08000201)...)
+	in = append(in, cobsPackage(coreFlag|0<<8, 200<<16|0xff19, 0x08000201)...)
+	in = append(in, cobsPackage(coreFlag|1<<8, 260<<16|0xff19, 0x08000201)...)
+	var out bytes.Buffer
+	dec := newCOBSDecoder(&out, make(id.TriceIDLookUp), new(sync.RWMutex), nil, nil, littleEndian)
+	dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, defaultSize)
+	var act string
+	for i := 0; i < 8; i++ {
+		n, _ := dec.Read(buf)
+		act += string(buf[:n])
+	}
+	assert.Equal(t, "", act)
+
+	out.Reset()
+	WriteFunctionTrace(&out)
+	flame, err := ioutil.ReadFile(FlameFile)
+	assert.Nil(t, err)
+	assert.Equal(t, "0x08000201 210\n", string(flame))
+	trace, err := ioutil.ReadFile(TraceFile)
+	assert.Nil(t, err)
+	exp := `{"traceEvents":[` +
+		`{"name":"0x08000201","ph":"B","ts":0,"pid":1,"tid":1},` +
+		`{"name":"0x08000201","ph":"B","ts":50,"pid":1,"tid":2},` +
+		`{"name":"0x08000201","ph":"E","ts":100,"pid":1,"tid":1},` +
+		`{"name":"0x08000201","ph":"E","ts":160,"pid":1,"tid":2}]}`
+	assert.Equal(t, exp, string(trace))
+}
+
+func TestFunctionName(t *testing.T) {
+	syms := []elfSymbol{{0x08000100, 0x20, "main"}, {0x08000200, 0, "f"}}
+	assert.Equal(t, "main", functionName(syms, 0x08000101))
+	assert.Equal(t, "main", functionName(syms, 0x0800011e))
+	assert.Equal(t, "0x08000120", functionName(syms, 0x08000120))
+	assert.Equal(t, "f", functionName(syms, 0x08000201))
+	assert.Equal(t, "0x080000ff", functionName(syms, 0x080000ff))
+	assert.Equal(t, "0x108000101", functionName(syms, 0x108000101))
+}
+
+// TestCOBSCoreMerge checks the merge of 2 core streams by target timestamp with own cycle counters.
+func TestCOBSCoreMerge(t *testing.T) {
+	lu := make(id.TriceIDLookUp)
+	assert.Nil(t, lu.FromJSON([]byte(`{"1701": {"Type": "TRICE32_1", "Strg": "msg:%d\n"}}`)))
+	lu.AddFmtCount(os.Stdout)
+	head := uint32(1701<<16 | 1<<8)
+	var in []byte
+	in = append(in, cobsPackage(1|coreFlag|0<<8, 10, head|0xc0, 1, 30, head|0xc1, 3)...) // core 0 at 10 and 30
+	in = append(in, cobsPackage(1|coreFlag|1<<8, 20, head|0xc0, 2, 40, head|0xc1, 4)...) // core 1 at 20 and 40
+	defer func(w int) { ReorderWindow = w }(ReorderWindow)
+	for _, x := range []struct {
+		window int
+		exp    string
+	}{
+		{256, "msg:1\nmsg:2\nmsg:3\nmsg:4\n"},
+		{0, "msg:1\nmsg:3\nmsg:2\nmsg:4\n"}, // package by package
+	} {
+		ReorderWindow = x.window
+		var out bytes.Buffer
+		dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, nil, littleEndian)
+		dec.setInput(ioutil.NopCloser(bytes.NewBuffer(in)))
+		buf := make([]byte, defaultSize)
+		var act string
+		for i := 0; i < 6; i++ {
+			n, _ := dec.Read(buf)
+			act += string(buf[:n])
+		}
+		assert.Equal(t, x.exp, act)
+	}
+}
@@ -103,6 +103,12 @@ var (
 	// Unsigned if true, forces hex and in values printed as unsigned values.
 	Unsigned bool
 
+	// FragmentDir is the directory for the buffers reassembled from target fragments. If empty, they are formatted like TRICE_N.
+	FragmentDir string
+
+	// fragmentFiles is the count of files written into FragmentDir. It is used for unique file names.
+	fragmentFiles int
+
 	matchNextFormatSpecifier        = regexp.MustCompile(patNextFormatSpecifier)
 	matchNextFormatUSpecifier       = regexp.MustCompile(patNextFormatUSpecifier)
 	matchNextFormatISpecifier       = regexp.MustCompile(patNextFormatISpecifier)
@@ -170,6 +176,8 @@ func handleSIGTERM(w io.Writer, rc io.ReadCloser) {
 				fmt.Fprintln(w, "####################################", sig, "####################################")
 			}
 			emitter.PrintColorChannelEvents(w)
+			PrintSpans(w)
+			WriteFunctionTrace(w)
 			msg.FatalOnErr(rc.Close())
 			os.Exit(0) // end
 		case <-ticker.C:
@@ -203,6 +211,8 @@ func Translate(w io.Writer, sw *emitter.TriceLineComposer, lut id.TriceIDLookUp,
 		//  case "COBSFF":
 		//  	dec = newCOBSDecoder(w, lut, m, rc, endian)
 		//  	cobsVariantDecode = cobsFFDecode
+	case "TCOBS":
+		dec = newTCOBSDecoder(w, lut, m, li, rwc, endian)
 	case "TREX":
 		dec = newTREXDecoder(w, lut, m, rwc, endian)
 	case "CHAR":
@@ -213,7 +223,7 @@ func Translate(w io.Writer, sw *emitter.TriceLineComposer, lut id.TriceIDLookUp,
 		log.Fatalf(fmt.Sprintln("unknown encoding ", Encoding))
 	}
 	if emitter.DisplayRemote {
-		keybcmd.ReadInput(rwc)
+		keybcmd.ReadInput(rwc, lut, m)
 	} else {
 		go handleSIGTERM(w, rwc)
 	}
@@ -238,6 +248,8 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec Decode
 					_, _ = sw.Write([]byte(`\n`)) // add newline as line end to display any started line
 				}
 				msg.OnErr(err)
+				PrintSpans(w)
+				WriteFunctionTrace(w)
 				return io.EOF
 			}
 			//  if Verbose {
@@ -251,6 +263,10 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec Decode
 			continue // read again
 		}
 
+		if SpansOnly { // only the span statistics are of interest
+			continue
+		}
+
 		// b contains here none or several complete trice strings.
 		// If several, they end with a newline each, despite the last one which optionally ends with a newline.
 		start := time.Now()
@@ -315,6 +331,15 @@ func (p *decoderData) readU32(b []byte) uint32 {
 	return binary.BigEndian.Uint32(b)
 }
 
+// writeU32 writes v into the 4 b bytes according the specified endianness
+func (p *decoderData) writeU32(b []byte, v uint32) {
+	if p.endian {
+		binary.LittleEndian.PutUint32(b, v)
+	} else {
+		binary.BigEndian.PutUint32(b, v)
+	}
+}
+
 // readU64 returns the 8 b bytes as uint64 according the specified endianness
 func (p *decoderData) readU64(b []byte) uint64 {
 	if p.endian {
@@ -0,0 +1,204 @@
+package decoder
+
+import (
+	"bytes"
+	"debug/elf"
+	"fmt"
+	"io/ioutil"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/rokath/trice/internal/id"
+	"github.com/tj/assert"
+)
+
+// harnessConfigs are the gcc options for the host simulation in pkg/src/harness: each trice mode without and with target location and timestamp,
+// and each trice mode with TRICE_FUNCTIONS.
+var harnessConfigs = func() (c []string) {
+	for _, mode := range []string{"0", "200", "201", "300"} {
+		for _, prefix := range []string{"", " -DHARNESS_LOCATION", " -DHARNESS_TIMESTAMP", " -DHARNESS_LOCATION -DHARNESS_TIMESTAMP"} {
+			c = append(c, "-DTRICE_MODE="+mode+prefix)
+		}
+	}
+	for _, mode := range []string{"0", "200", "201", "300"} {
+		c = append(c, "-DTRICE_MODE="+mode+" -DHARNESS_LOCATION -DTRICE_FUNCTIONS")
+	}
+	return
+}()
+
+// harnessBinary is the host simulation for one of the harnessConfigs.
+type harnessBinary struct {
+	exe       string // exe is the executable.
+	checkText uint64 // checkText is the code size of triceCheck.c, so of the TRICE call sites.
+	triceText uint64 // triceText is the code size of trice.c.
+}
+
+// harnessTextSize returns the size of the code sections in ELF object file fn, or 0 on hosts with other object files.
+func harnessTextSize(fn string) (n uint64) {
+	f, err := elf.Open(fn)
+	if err != nil {
+		return
+	}
+	defer f.Close()
+	for _, s := range f.Sections {
+		if s.Flags&elf.SHF_EXECINSTR != 0 {
+			n += s.Size
+		}
+	}
+	return
+}
+
+// harnessBuild compiles the host simulation for all harnessConfigs concurrently into dir.
+// triceCheck.c and trice.c are compiled separately, so that their code sizes are measurable. It skips without gcc.
+func harnessBuild(tb testing.TB, dir string) []harnessBinary {
+	gcc, err := exec.LookPath("gcc")
+	if err != nil {
+		tb.Skip("gcc not found")
+	}
+	src := filepath.Join("..", "..", "pkg", "src")
+	bins := make([]harnessBinary, len(harnessConfigs))
+	errs := make([]error, len(harnessConfigs))
+	var wg sync.WaitGroup
+	for i, options := range harnessConfigs {
+		base := filepath.Join(dir, strconv.Itoa(i))
+		flags := append([]string{"-O2", "-Wall", "-I" + filepath.Join(src, "harness"), "-I" + src}, strings.Fields(options)...)
+		steps := [][]string{
+			append(append([]string{}, flags...), "-c", filepath.Join(src, "triceCheck.c"), "-o", base+"check.o"),
+			append(append([]string{}, flags...), "-c", filepath.Join(src, "trice.c"), "-o", base+"trice.o"),
+			append(append([]string{}, flags...), filepath.Join(src, "harness", "harness.c"), filepath.Join(src, "tcobs.c"), base+"check.o", base+"trice.o", "-o", base),
+		}
+		wg.Add(1)
+		go func(i int, base string, steps [][]string) {
+			defer wg.Done()
+			for _, args := range steps {
+				if out, err := exec.Command(gcc, args...).CombinedOutput(); err != nil {
+					errs[i] = fmt.Errorf("%s: %v\n%s", harnessConfigs[i], err, out)
+					return
+				}
+			}
+			bins[i] = harnessBinary{base, harnessTextSize(base + "check.o"), harnessTextSize(base + "trice.o")}
+		}(i, base, steps)
+	}
+	wg.Wait()
+	for _, err := range errs {
+		if err != nil {
+			tb.Fatal(err)
+		}
+	}
+	return bins
+}
+
+// harnessRun runs all TriceCheckSet indices rounds times and returns the COBS packages and the encode time.
+func harnessRun(tb testing.TB, exe string, rounds int) ([]byte, time.Duration) {
+	var stdout, stderr bytes.Buffer
+	cmd := exec.Command(exe, strconv.Itoa(rounds))
+	cmd.Stdout = &stdout
+	cmd.Stderr = &stderr
+	if err := cmd.Run(); err != nil {
+		tb.Fatal(exe, err)
+	}
+	ns, err := strconv.ParseInt(strings.TrimSpace(stderr.String()), 10, 64)
+	if err != nil {
+		tb.Fatal(exe, err)
+	}
+	return stdout.Bytes(), time.Duration(ns)
+}
+
+// harnessLookUp returns the til.json IDs used in triceCheck.c.
+func harnessLookUp(tb testing.TB) id.TriceIDLookUp {
+	b, err := ioutil.ReadFile(filepath.Join("..", "..", "til.json"))
+	if err != nil {
+		tb.Fatal(err)
+	}
+	lu := make(id.TriceIDLookUp)
+	if err := lu.FromJSON(b); err != nil {
+		tb.Fatal(err)
+	}
+	lu.AddFmtCount(ioutil.Discard)
+	return lu
+}
+
+// harnessDecode decodes the COBS packages in b and returns the text, the trice count and the decode time.
+func harnessDecode(lu id.TriceIDLookUp, b []byte) (string, int, time.Duration) {
+	targetTimestampExists, targetLocationExists = false, false // Read uses them from the previous package for the min package size
+	var out bytes.Buffer
+	in := bytes.NewReader(b)
+	dec := newCOBSDecoder(&out, lu, new(sync.RWMutex), nil, in, littleEndian)
+	p := dec.(*cobsDec)
+	buf := make([]byte, defaultSize)
+	var text strings.Builder
+	count := 0
+	start := time.Now()
+	for {
+		n, _ := dec.Read(buf)
+		if n > 0 {
+			text.Write(buf[:n])
+			count++
+		} else if in.Len() == 0 && len(p.b) == 0 && bytes.IndexByte(p.iBuf, 0) < 0 {
+			break // all packages done
+		}
+	}
+	return strings.Replace(text.String(), `\n`, "\n", -1), count, time.Since(start) // the emitter resolves the escapes usually
+}
+
+// TestHarness compiles pkg/src for each trice mode and prefix option, runs all TriceCheckSet indices on the host
+// and checks the decoded text against testdata/triceCheck.txt. It logs the code sizes and the encode and decode time per trice.
+// All configurations must decode to the same text. HARNESS_UPDATE=1 rewrites testdata/triceCheck.txt after an intended change.
+func TestHarness(t *testing.T) {
+	if testing.Short() {
+		t.Skip("compiles pkg/src for each configuration")
+	}
+	dir, err := ioutil.TempDir("", "harness")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	exp, err := ioutil.ReadFile(filepath.Join("testdata", "triceCheck.txt"))
+	assert.Nil(t, err)
+	lu := harnessLookUp(t)
+	bins := harnessBuild(t, dir)
+	for i, options := range harnessConfigs {
+		b, encode := harnessRun(t, bins[i].exe, 1)
+		act, count, decode := harnessDecode(lu, b)
+		if os.Getenv("HARNESS_UPDATE") != "" {
+			assert.Nil(t, ioutil.WriteFile(filepath.Join("testdata", "triceCheck.txt"), []byte(act), 0644))
+			exp = []byte(act)
+		}
+		assert.Equal(t, string(exp), act)
+		t.Logf("%-55s %6d+%5d code bytes %5d trices %8.0f encode ns/trice %8.0f decode ns/trice", options, bins[i].checkText, bins[i].triceText,
+			count, float64(encode.Nanoseconds())/float64(count), float64(decode.Nanoseconds())/float64(count))
+	}
+}
+
+// BenchmarkHarness reports the encode and decode time per trice for each trice mode and prefix option.
+// Each operation runs all TriceCheckSet indices 10 times in a new process.
+// check-bytes is the code size of the TRICE call sites in triceCheck.c and trice-bytes the code size of trice.c.
+func BenchmarkHarness(b *testing.B) {
+	dir, err := ioutil.TempDir("", "harness")
+	assert.Nil(b, err)
+	defer os.RemoveAll(dir)
+	lu := harnessLookUp(b)
+	bins := harnessBuild(b, dir)
+	for i, options := range harnessConfigs {
+		bin := bins[i]
+		b.Run(strings.Replace(options, " ", "", -1), func(b *testing.B) {
+			var encode, decode time.Duration
+			count := 0
+			for i := 0; i < b.N; i++ {
+				out, e := harnessRun(b, bin.exe, 10)
+				_, n, d := harnessDecode(lu, out)
+				encode += e
+				decode += d
+				count += n
+			}
+			b.ReportMetric(float64(encode.Nanoseconds())/float64(count), "encode-ns/trice")
+			b.ReportMetric(float64(decode.Nanoseconds())/float64(count), "decode-ns/trice")
+			b.ReportMetric(float64(bin.checkText), "check-bytes")
+			b.ReportMetric(float64(bin.triceText), "trice-bytes")
+		})
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+// merge of the per core trice streams from targets with TRICE_RING_CORES > 1 by target timestamp
+
+// ReorderWindow is the max count of trices from core tagged packages held back for merging the core streams by target timestamp.
+var ReorderWindow = 256
+
+// coreFlag marks packages with a core number in the COBS package descriptor bits 15...8.
+const coreFlag = 64
+
+// coreRecord is a single trice from a core tagged package.
+type coreRecord struct {
+	descriptor uint32 // descriptor is the COBS package descriptor of the package the trice came with.
+	timestamp  uint32 // timestamp is the target timestamp of the trice.
+	seq        uint64 // seq is the reception order for trices with equal timestamps.
+	b          []byte // b is the trice with its prefix.
+}
+
+// selectStream switches the cycle counter check to stream, 0 for untagged packages and core+1 for core tagged packages.
+// Each core has its own cycle counter.
+func (p *cobsDec) selectStream(stream int) {
+	p.cycles[p.stream] = p.cycle - 0xc0 // stored as offset, so the zero value is the start value 0xc0
+	p.stream = stream
+	p.cycle = p.cycles[stream] + 0xc0
+}
+
+// splitPackage stores the trices of the core tagged package in p.b into the stream of its core and returns false,
+// if it cannot split the package. Only packages with target timestamps and without delta timestamps and packed parameters are split.
+func (p *cobsDec) splitPackage() bool {
+	var prefix, tsOffset int
+	switch p.COBSModeDescriptor &^ (16 | 32 | coreFlag | 0xff00) {
+	case 1:
+		prefix, tsOffset = 4, 0
+	case 3:
+		prefix, tsOffset = 8, 4
+	default:
+		return false
+	}
+	var records []coreRecord
+	for b := p.b; len(b) > 0; {
+		if len(b) < prefix+headSize {
+			return false
+		}
+		head := p.readU32(b[prefix:])
+		size := prefix + headSize + int(head>>8&0xff)<<2
+		if head&0xff00 == 0xff00 { // control record with its word count in the lowest 2 bits
+			size = prefix + headSize + int(head&3)<<2
+		}
+		if len(b) < size {
+			return false
+		}
+		records = append(records, coreRecord{p.COBSModeDescriptor, p.readU32(b[tsOffset:]), p.seq, b[:size]})
+		p.seq++
+		b = b[size:]
+	}
+	if p.streams == nil {
+		p.streams = make(map[int][]coreRecord)
+	}
+	stream := int(p.COBSModeDescriptor>>8&0xff) + 1
+	p.streams[stream] = append(p.streams[stream], records...)
+	p.pending += len(records)
+	p.b = p.b[:0]
+	return true
+}
+
+// popRecord moves the trice with the oldest timestamp from the heads of all core streams into p.b.
+// The trices of one core keep their order, so its cycle counter stays consecutive.
+func (p *cobsDec) popRecord() {
+	stream := -1
+	var r coreRecord
+	for s, rs := range p.streams {
+		if len(rs) == 0 {
+			continue
+		}
+		d := int32(rs[0].timestamp - r.timestamp) // the target timestamp can wrap
+		if stream < 0 || d < 0 || d == 0 && rs[0].seq < r.seq {
+			stream, r = s, rs[0]
+		}
+	}
+	p.streams[stream] = p.streams[stream][1:]
+	p.pending--
+	p.COBSModeDescriptor = r.descriptor
+	p.preReset = r.descriptor&16 != 0
+	p.b = r.b
+	p.selectStream(stream)
+}
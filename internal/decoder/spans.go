@@ -0,0 +1,112 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+// span profiling with the target TRICE_SPAN_BEGIN and TRICE_SPAN_END control records
+
+import (
+	"fmt"
+	"io"
+	"math/bits"
+	"sort"
+	"strings"
+
+	"github.com/rokath/trice/internal/id"
+)
+
+// span holds the open begins and the durations of all spans with one name.
+type span struct {
+	begins map[int][]uint32 // begins holds for each stream a stack of clock values, so nested spans with the same name pair last in first out.
+	ticks  []uint32         // ticks are the durations of the complete spans in TRICE_SPAN_CLOCK ticks.
+}
+
+var (
+	// SpansOnly suppresses the trice output, so that only the span statistics are shown. The sub-command spans sets it.
+	SpansOnly bool
+
+	// spans holds the span data for each span name.
+	spans = make(map[string]*span)
+)
+
+// spanName returns the til.json name of a span ID, or "ID n" for an unknown ID.
+func (p *cobsDec) spanName(triceID id.TriceID) string {
+	p.lutMutex.RLock()
+	t, ok := p.lut[triceID]
+	p.lutMutex.RUnlock()
+	if ok && strings.HasPrefix(strings.ToUpper(t.Type), "TRICE_SPAN") {
+		return t.Strg
+	}
+	return fmt.Sprintf("ID %d", triceID)
+}
+
+// spanBegin opens span name inside stream at clock.
+// Each core has its own stream, so the same span running on several cores pairs per core.
+func spanBegin(name string, stream int, clock uint32) {
+	s, ok := spans[name]
+	if !ok {
+		s = &span{begins: make(map[int][]uint32)}
+		spans[name] = s
+	}
+	s.begins[stream] = append(s.begins[stream], clock)
+}
+
+// spanEnd closes the last opened span name inside stream at clock and returns false, if there is none.
+func spanEnd(name string, stream int, clock uint32) bool {
+	s, ok := spans[name]
+	if !ok || len(s.begins[stream]) == 0 {
+		return false
+	}
+	last := len(s.begins[stream]) - 1
+	s.ticks = append(s.ticks, clock-s.begins[stream][last]) // the clock can wrap
+	s.begins[stream] = s.begins[stream][:last]
+	return true
+}
+
+// spansLost drops the open begins of all spans, because the target dropped trices, which can contain a span end.
+// Otherwise a later end would close the wrong begin.
+func spansLost() {
+	for _, s := range spans {
+		s.begins = make(map[int][]uint32)
+	}
+}
+
+// PrintSpans writes count, min, avg, max and 99th percentile in clock ticks for each span name into w,
+// followed by a histogram line with the span counts in power of 2 tick ranges. It writes nothing without spans.
+func PrintSpans(w io.Writer) {
+	names := make([]string, 0, len(spans))
+	for name, s := range spans {
+		if len(s.ticks) > 0 {
+			names = append(names, name)
+		}
+	}
+	if len(names) == 0 {
+		return
+	}
+	sort.Strings(names)
+	fmt.Fprintf(w, "%-24s %10s %10s %10s %10s %10s (ticks)\n", "span", "count", "min", "avg", "max", "p99")
+	for _, name := range names {
+		t := append([]uint32(nil), spans[name].ticks...)
+		sort.Slice(t, func(i, j int) bool { return t[i] < t[j] })
+		var sum uint64
+		var histogram [33]int // histogram[k] counts the spans with a bit length k
+		for _, v := range t {
+			sum += uint64(v)
+			histogram[bits.Len32(v)]++
+		}
+		p99 := t[(len(t)*99+99)/100-1] // nearest rank
+		fmt.Fprintf(w, "%-24s %10d %10d %10d %10d %10d\n", name, len(t), t[0], sum/uint64(len(t)), t[len(t)-1], p99)
+		var h []string
+		for k, n := range histogram {
+			if n == 0 {
+				continue
+			}
+			if k == 0 {
+				h = append(h, fmt.Sprintf("0:%d", n))
+			} else {
+				h = append(h, fmt.Sprintf("%d-%d:%d", uint64(1)<<uint(k-1), uint64(1)<<uint(k)-1, n))
+			}
+		}
+		fmt.Fprintf(w, "%-24s %s\n", "", strings.Join(h, " "))
+	}
+}
@@ -0,0 +1,23 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"io"
+	"sync"
+
+	"github.com/rokath/trice/internal/id"
+	"github.com/rokath/trice/pkg/tcobs"
+)
+
+// newTCOBSDecoder provides a TCOBS decoder instance.
+//
+// TCOBS packages carry the same data as COBS packages, only the framing differs.
+// l is the trice id list in slice of struct format.
+// in is the usable reader for the input bytes.
+func newTCOBSDecoder(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) Decoder {
+	p := newCOBSDecoder(w, lut, m, li, in, endian).(*cobsDec)
+	p.frameDecode = tcobs.Decode
+	return p
+}
@@ -0,0 +1,23 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+// TestTCOBS uses the TestCOBS packages TCOBS encoded.
+func TestTCOBS(t *testing.T) {
+	tt := testTable{ // little endian
+		{[]byte{0x01, 0x61, 0xd0, 0x07, 0x42, 0xc0, 0x01, 0xc4, 0xbc, 0x64, 0x20, 0x00}, `MSG: START select = 0, TriceDepthMax =   0`},
+		{[]byte{0x01, 0x61, 0xd1, 0x07, 0x42, 0xc1, 0x01, 0xcd, 0xd1, 0x44, 0x1c, 0x21, 0x00}, `MSG: STOP  select = 0, TriceDepthMax =  28`},
+		{[]byte{0x03, 0x61, 0x13, 0x21, 0x38, 0xcb, 0x11, 0x13, 0xc0, 0x01, 0x83, 0xe5, 0x84, 0x00}, `rd:TRICE32_1 line -1 (%d)`},
+	}
+	var out bytes.Buffer
+	doCOBSTableTest(t, &out, newTCOBSDecoder, littleEndian, tt)
+	assert.Equal(t, "", out.String())
+}
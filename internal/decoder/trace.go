@@ -0,0 +1,218 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+// function trace from the target TRICE_FUNCTION_TRACE control records
+
+import (
+	"debug/elf"
+	"encoding/json"
+	"fmt"
+	"io"
+	"io/ioutil"
+	"sort"
+	"strings"
+)
+
+var (
+	// ElfFile is the target ELF file with the function names for the function trace. Without it the addresses are shown.
+	ElfFile string
+
+	// TraceFile is the output file for the function trace in the Chrome trace event JSON format, which Perfetto opens.
+	TraceFile string
+
+	// FlameFile is the output file for the function trace as folded stacks with self time ticks for flame graph tools.
+	FlameFile string
+
+	// TraceClock is the TRICE_FUNCTION_CLOCK frequency in MHz for the microsecond timestamps inside TraceFile.
+	TraceClock float64
+
+	// functionEvents are the function enter and exit events received so far.
+	functionEvents []functionEvent
+
+	// functionClocks holds for each stream the unwrapped clock of its last function event.
+	functionClocks map[int]*functionClock
+
+	// functionLast is the unwrapped clock of the last function event of any stream. A new stream starts relative to it.
+	functionLast *functionClock
+)
+
+// functionClock is an unwrapped function trace clock.
+type functionClock struct {
+	ticks int64  // ticks is the clock tick count since the first function event.
+	value uint16 // value is the target clock lower half.
+}
+
+// functionEvent is a target function enter or exit.
+type functionEvent struct {
+	stream int    // stream is 0 for untagged packages and core+1 for core tagged packages.
+	enter  bool   // enter is false for an exit.
+	addr   uint64 // addr is the function address.
+	clock  int64  // clock is the clock tick count since the first event.
+}
+
+// functionTraceEvent stores a function event of stream with the lower target clock half, when a function trace output file is selected.
+// The clock difference to the previous event of the same stream is signed, because an event interrupted after reading the clock comes after the interrupting ones.
+// So successive events must be less than 32768 ticks apart.
+func functionTraceEvent(stream int, enter bool, addr uint64, value uint16) {
+	if TraceFile == "" && FlameFile == "" {
+		return
+	}
+	if functionClocks == nil {
+		functionClocks = make(map[int]*functionClock)
+	}
+	c, ok := functionClocks[stream]
+	if !ok {
+		c = &functionClock{value: value}
+		if functionLast != nil {
+			*c = *functionLast
+		}
+		functionClocks[stream] = c
+	}
+	c.ticks += int64(int16(value - c.value)) // the clock wraps
+	c.value = value
+	functionLast = c
+	functionEvents = append(functionEvents, functionEvent{stream, enter, addr, c.ticks})
+}
+
+// elfSymbol is a function symbol from ElfFile.
+type elfSymbol struct {
+	addr uint64
+	size uint64
+	name string
+}
+
+// elfFunctions returns the function symbols of ELF file fn sorted by address.
+func elfFunctions(fn string) (syms []elfSymbol, err error) {
+	f, err := elf.Open(fn)
+	if err != nil {
+		return
+	}
+	defer f.Close()
+	all, err := f.Symbols()
+	if err != nil {
+		return
+	}
+	for _, s := range all {
+		if elf.ST_TYPE(s.Info) == elf.STT_FUNC && s.Value != 0 {
+			syms = append(syms, elfSymbol{s.Value &^ 1, s.Size, s.Name}) // clear the ARM thumb bit
+		}
+	}
+	sort.Slice(syms, func(i, j int) bool { return syms[i].addr < syms[j].addr })
+	return
+}
+
+// functionName returns the name of the function at addr inside syms or the address as hex string.
+func functionName(syms []elfSymbol, addr uint64) string {
+	a := addr &^ 1
+	i := sort.Search(len(syms), func(i int) bool { return syms[i].addr > a }) - 1
+	if i >= 0 && (a < syms[i].addr+syms[i].size || a == syms[i].addr) {
+		return syms[i].name
+	}
+	return fmt.Sprintf("0x%08x", addr)
+}
+
+// chromeEvent is a duration event in the Chrome trace event format.
+type chromeEvent struct {
+	Name  string  `json:"name"`
+	Phase string  `json:"ph"`
+	Ts    float64 `json:"ts"`
+	Pid   int     `json:"pid"`
+	Tid   int     `json:"tid"`
+}
+
+// functionFrame is an active function call during the function trace evaluation.
+type functionFrame struct {
+	addr  uint64
+	name  string
+	enter int64 // enter is the clock on function entry.
+	child int64 // child is the clock ticks spent in called functions.
+}
+
+// evaluateFunctionTrace turns the function events into Chrome trace events and folded stacks with their self time ticks.
+// Each stream has its own call stack and is a Chrome thread, the untagged stream 0 is thread 1 like core 0.
+// An exit without matching entry is ignored. An exit of a calling function ends the functions called by it too.
+func evaluateFunctionTrace(syms []elfSymbol) (events []chromeEvent, folded map[string]uint64) {
+	folded = make(map[string]uint64)
+	stacks := make(map[int][]functionFrame)
+	ts := func(clock int64) float64 { return float64(clock) / TraceClock }
+	for _, e := range functionEvents {
+		tid := e.stream
+		if tid == 0 {
+			tid = 1
+		}
+		stack := stacks[e.stream]
+		if e.enter {
+			f := functionFrame{e.addr, functionName(syms, e.addr), e.clock, 0}
+			stacks[e.stream] = append(stack, f)
+			events = append(events, chromeEvent{f.name, "B", ts(e.clock), 1, tid})
+			continue
+		}
+		i := len(stack) - 1
+		for i >= 0 && stack[i].addr != e.addr {
+			i--
+		}
+		if i < 0 {
+			continue
+		}
+		for len(stack) > i {
+			f := stack[len(stack)-1]
+			names := make([]string, len(stack))
+			for k := range stack {
+				names[k] = stack[k].name
+			}
+			total := e.clock - f.enter
+			if self := total - f.child; self > 0 {
+				folded[strings.Join(names, ";")] += uint64(self)
+			}
+			stack = stack[:len(stack)-1]
+			if len(stack) > 0 {
+				stack[len(stack)-1].child += total
+			}
+			events = append(events, chromeEvent{f.name, "E", ts(e.clock), 1, tid})
+		}
+		stacks[e.stream] = stack
+	}
+	return
+}
+
+// WriteFunctionTrace writes the received function events into TraceFile and FlameFile. It writes nothing without events.
+func WriteFunctionTrace(w io.Writer) {
+	if len(functionEvents) == 0 {
+		return
+	}
+	var syms []elfSymbol
+	if ElfFile != "" {
+		var err error
+		if syms, err = elfFunctions(ElfFile); err != nil {
+			fmt.Fprintln(w, "err:", err)
+		}
+	}
+	events, folded := evaluateFunctionTrace(syms)
+	if TraceFile != "" {
+		b, err := json.Marshal(struct {
+			TraceEvents []chromeEvent `json:"traceEvents"`
+		}{events})
+		if err == nil {
+			err = ioutil.WriteFile(TraceFile, b, 0644)
+		}
+		if err != nil {
+			fmt.Fprintln(w, "err:", err)
+		} else {
+			fmt.Fprintln(w, "info:", len(functionEvents), "function events written to", TraceFile)
+		}
+	}
+	if FlameFile != "" {
+		stacks := make([]string, 0, len(folded))
+		for s, n := range folded {
+			stacks = append(stacks, fmt.Sprintln(s, n))
+		}
+		sort.Strings(stacks)
+		if err := ioutil.WriteFile(FlameFile, []byte(strings.Join(stacks, "")), 0644); err != nil {
+			fmt.Fprintln(w, "err:", err)
+		} else {
+			fmt.Fprintln(w, "info:", len(folded), "call stacks written to", FlameFile)
+		}
+	}
+}
@@ -85,6 +85,7 @@ var (
 	colorizeASSERT  = ansi.ColorFunc("yellow+i:blue")
 	colorizeALARM   = ansi.ColorFunc("red+i:white+h")
 	colorizeCYCLE   = ansi.ColorFunc("blue+i:default+h")
+	colorizeLOST    = ansi.ColorFunc("red+i:default+h")
 	colorizeVERBOSE = ansi.ColorFunc("blue:default")
 )
 
@@ -133,6 +134,7 @@ var colorChannels = []colorChannel{
 	{0, []string{"Assert", "assert", "ASSERT"}, colorizeASSERT},
 	{0, []string{"Alarm", "alarm", "ALARM"}, colorizeALARM},
 	{0, []string{"cycle", "CYCLE"}, colorizeCYCLE},
+	{0, []string{"lost", "LOST"}, colorizeLOST},
 	{0, []string{"Verbose", "verbose", "VERBOSE"}, colorizeVERBOSE},
 }
 
@@ -149,6 +151,34 @@ func ColorChannelEvents(ch string) int {
 	return -1
 }
 
+// ChannelLevel returns the numeric log level of channel ch like used for LogLevel, what is its index inside colorChannels.
+// An unknown channel has level 0.
+func ChannelLevel(ch string) (level int) {
+	for i, s := range colorChannels {
+		for _, c := range s.channel {
+			if c == ch {
+				level = i
+			}
+		}
+	}
+	return
+}
+
+// ChannelLevelNames returns an upper case name for each numeric log level.
+// It is the first channel variant with at least 3 characters.
+func ChannelLevelNames() (names []string) {
+	for _, s := range colorChannels {
+		name := s.channel[0]
+		for _, c := range s.channel {
+			if len(name) < 3 && len(c) > len(name) {
+				name = c
+			}
+		}
+		names = append(names, strings.ToUpper(name))
+	}
+	return
+}
+
 // PrintColorChannelEvents shows the amount of occurred channel events.
 func PrintColorChannelEvents(w io.Writer) {
 	for _, s := range colorChannels {
@@ -24,6 +24,9 @@ var (
 	// LIFnJSON is the filename for the JSON formatted location information list.
 	LIFnJSON string
 
+	// FnTilH is the filename for the generated C header with ID metadata. It is not written, when empty.
+	FnTilH string
+
 	// Min is the smallest allowed ID for normal trices.
 	Min = TriceID(32768)
 
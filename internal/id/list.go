@@ -97,6 +97,9 @@ func SubCmdUpdate(w io.Writer) error {
 	if (len(lu) != o || listModified) && !DryRun {
 		msg.FatalOnErr(lu.toFile(FnJSON))
 	}
+	if FnTilH != "" && !DryRun {
+		msg.FatalOnErr(lu.toCHeaderFile(FnTilH))
+	}
 	return lim.toFile(LIFnJSON)
 }
 
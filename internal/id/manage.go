@@ -13,6 +13,7 @@ import (
 	"io/ioutil"
 	"math/rand"
 	"os"
+	"sort"
 	"strings"
 
 	"github.com/rokath/trice/pkg/msg"
@@ -183,6 +184,17 @@ func (lu TriceIDLookUp) AddFmtCount(w io.Writer) {
 	}
 }
 
+// ChannelIDs returns the sorted IDs of all format strings starting with channel ch and a colon, like "dbg:".
+func (lu TriceIDLookUp) ChannelIDs(ch string) (ids []TriceID) {
+	for id, tF := range lu {
+		if strings.HasPrefix(tF.Strg, ch+":") {
+			ids = append(ids, id)
+		}
+	}
+	sort.Slice(ids, func(i, j int) bool { return ids[i] < ids[j] })
+	return
+}
+
 // toJSON converts lut into JSON byte slice in human-readable form.
 func (lu TriceIDLookUp) toJSON() ([]byte, error) {
 	return json.MarshalIndent(lu, "", "\t")
@@ -98,3 +98,14 @@ func TestLutFileTransfer(t *testing.T) {
 	act := fmt.Sprint(rd)
 	assert.Equal(t, exp, act)
 }
+
+// TestChannelIDs checks the channel ID selection.
+func TestChannelIDs(t *testing.T) {
+	lu := make(TriceIDLookUp)
+	lu[7] = TriceFmt{Type: "TRICE0", Strg: "dbg:seven\\n"}
+	lu[3] = TriceFmt{Type: "TRICE0", Strg: "dbg:three\\n"}
+	lu[5] = TriceFmt{Type: "TRICE0", Strg: "msg:five\\n"}
+	lu[9] = TriceFmt{Type: "TRICE0", Strg: "dbgx:nine\\n"}
+	assert.Equal(t, []TriceID{3, 7}, lu.ChannelIDs("dbg"))
+	assert.Equal(t, []TriceID(nil), lu.ChannelIDs("err"))
+}
@@ -0,0 +1,137 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+// C header generation with ID metadata
+
+import (
+	"fmt"
+	"io"
+	"os"
+	"sort"
+	"strconv"
+	"strings"
+
+	"github.com/rokath/trice/internal/emitter"
+)
+
+// channel returns the channel prefix of format string s, like "dbg" for "dbg:x=%d\n", or "" if there is none.
+func channel(s string) string {
+	i := strings.IndexByte(s, ':')
+	if i <= 0 {
+		return ""
+	}
+	for _, c := range s[:i] {
+		if !(c == '_' || '0' <= c && c <= '9' || 'a' <= c && c <= 'z' || 'A' <= c && c <= 'Z') {
+			return ""
+		}
+	}
+	return s[:i]
+}
+
+// paramSize returns the parameter byte size of a trice in the target buffer without head.
+// Dynamic length trices like TRICE_S and the C++ TRICE_M with compile time parameter widths return -1.
+func paramSize(tF TriceFmt) int {
+	t := strings.ToUpper(tF.Type)
+	if t == "TRICE_S" || t == "TRICE_N" || t == "TRICE_M" {
+		return -1
+	}
+	s := strings.SplitN(strings.TrimPrefix(t, "TRICE"), "_", 2) // "", "8", "0", "_2", "8_2"
+	if s[0] == "0" {
+		return 0
+	}
+	bits := DefaultTriceBitWidth
+	if s[0] != "" {
+		bits = s[0]
+	}
+	b, err := strconv.Atoi(bits)
+	if err != nil {
+		return -1
+	}
+	n := formatSpecifierCount(tF.Strg)
+	if len(s) == 2 {
+		if n, err = strconv.Atoi(s[1]); err != nil {
+			return -1
+		}
+	}
+	return (b/8*n + 3) &^ 3
+}
+
+// toCHeader writes lu as C header with channel, level and parameter size for each trice ID.
+//
+// The levels are the channel indices the trice tool uses with -logLevel.
+// File IDs are skipped.
+func (lu TriceIDLookUp) toCHeader(w io.Writer) {
+	ids := make([]TriceID, 0, len(lu))
+	for id, tF := range lu {
+		if tF.Type != "TRICE_FILE" {
+			ids = append(ids, id)
+		}
+	}
+	sort.Slice(ids, func(i, j int) bool { return ids[i] < ids[j] })
+
+	fmt.Fprintln(w, `/*! \file til.h
+\brief trice ID metadata generated by "trice update -tilh" from the trice ID list. Do not edit.
+*******************************************************************************/
+
+#ifndef TIL_H_
+#define TIL_H_
+
+#include <stdint.h>
+
+#ifndef TRICE_INLINE
+#define TRICE_INLINE static inline
+#endif
+
+// Channel levels like used by the trice tool -logLevel switch. A bigger value is less important.`)
+	for i, name := range emitter.ChannelLevelNames() {
+		fmt.Fprintf(w, "#define TRICE_LEVEL_%s %d\n", name, i)
+	}
+
+	maxSize := 0
+	for _, id := range ids {
+		if n := paramSize(lu[id]); n > maxSize {
+			maxSize = n
+		}
+	}
+	fmt.Fprintf(w, "\n#define TRICE_TIL_MAX_SIZE %d //!< TRICE_TIL_MAX_SIZE is the biggest head plus parameter size of all trices without dynamic length.\n", 4+maxSize)
+
+	fmt.Fprintln(w, "\n// Channel, level and parameter byte size for each ID. Dynamic length trices have size -1.")
+	for _, id := range ids {
+		ch := channel(lu[id].Strg)
+		fmt.Fprintf(w, "#define TIL_%d_CHANNEL \"%s\"\n", id, ch)
+		fmt.Fprintf(w, "#define TIL_%d_LEVEL %d\n", id, emitter.ChannelLevel(ch))
+		fmt.Fprintf(w, "#define TIL_%d_SIZE %d\n", id, paramSize(lu[id]))
+	}
+
+	fmt.Fprintln(w, `
+//! triceIdLevel returns the channel level of a trice id like Id(58755).
+//! For a constant id the compiler folds it to a constant, so with TRICE_LEVEL the trices above it generate no code.
+TRICE_INLINE int triceIdLevel( uint32_t id ){
+    switch( id >> 16 ){`)
+	for _, id := range ids {
+		if emitter.ChannelLevel(channel(lu[id].Strg)) != 0 {
+			fmt.Fprintf(w, "        case %d: return TIL_%d_LEVEL;\n", id, id)
+		}
+	}
+	fmt.Fprintln(w, `        default: return 0;
+    }
+}
+
+#endif // TIL_H_`)
+}
+
+// toCHeaderFile writes lu as C header into file fn.
+func (lu TriceIDLookUp) toCHeaderFile(fn string) (err error) {
+	var f *os.File
+	f, err = os.Create(fn)
+	if err != nil {
+		return
+	}
+	defer func() {
+		err = f.Close()
+	}()
+	lu.toCHeader(f)
+	return
+}
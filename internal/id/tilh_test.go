@@ -0,0 +1,58 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// white-box test
+package id
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+// TestParamSize checks the parameter sizes for several trice types.
+func TestParamSize(t *testing.T) {
+	for _, x := range []struct {
+		tF  TriceFmt
+		exp int
+	}{
+		{TriceFmt{"TRICE0", "hi\\n"}, 0},
+		{TriceFmt{"TRICE8_3", "%d %d %d\\n"}, 4},
+		{TriceFmt{"TRICE8_5", "%d %d %d %d %d\\n"}, 8},
+		{TriceFmt{"TRICE16", "%d %d %d\\n"}, 8},
+		{TriceFmt{"trice32_1", "%d\\n"}, 4},
+		{TriceFmt{"TRICE64_2", "%d %d\\n"}, 16},
+		{TriceFmt{"TRICE", "%d %d\\n"}, 8},
+		{TriceFmt{"TRICE_3", "%d %d %d\\n"}, 12},
+		{TriceFmt{"TRICE_S", "%s\\n"}, -1},
+	} {
+		assert.Equal(t, x.exp, paramSize(x.tF), x.tF.Type)
+	}
+}
+
+// TestCHeader checks the generated metadata lines.
+func TestCHeader(t *testing.T) {
+	lu := TriceIDLookUp{
+		100: {"TRICE32_2", "dbg:%d %d\\n"},
+		200: {"TRICE_S", "err:%s\\n"},
+		300: {"TRICE0", "no channel\\n"},
+		400: {"TRICE_FILE", "main.c"},
+	}
+	var b bytes.Buffer
+	lu.toCHeader(&b)
+	s := b.String()
+	for _, exp := range []string{
+		"#define TRICE_LEVEL_FATAL 0\n",
+		"#define TRICE_LEVEL_DEBUG 7\n",
+		"#define TRICE_TIL_MAX_SIZE 12 ",
+		"#define TIL_100_CHANNEL \"dbg\"\n#define TIL_100_LEVEL 7\n#define TIL_100_SIZE 8\n",
+		"#define TIL_200_CHANNEL \"err\"\n#define TIL_200_LEVEL 3\n#define TIL_200_SIZE -1\n",
+		"#define TIL_300_CHANNEL \"\"\n#define TIL_300_LEVEL 0\n#define TIL_300_SIZE 0\n",
+		"        case 100: return TIL_100_LEVEL;\n        case 200: return TIL_200_LEVEL;\n        default: return 0;\n",
+	} {
+		assert.True(t, strings.Contains(s, exp), exp)
+	}
+	assert.False(t, strings.Contains(s, "TIL_400"))
+}
@@ -41,6 +41,7 @@ var tryOkSet = []idCheck{
 	{`TRICE0(Id( 59 ), "tt" )`, "Id( 59 )", 59, true, TriceFmt{"TRICE0", "tt"}},
 	{`trice0(Id(59), "tt" )`, "Id(59)", 59, true, TriceFmt{"trice0", "tt"}},
 	{`trice64_2(Id(59), "%d,%x", -3, -4 )`, "Id(59)", 59, true, TriceFmt{"trice64_2", "%d,%x"}},
+	{`TRICE_M(Id(59), "%d,%f", i8, d )`, "Id(59)", 59, true, TriceFmt{"TRICE_M", "%d,%f"}},
 }
 
 func checkID(t *testing.T, set []idCheck, i int, id TriceID) {
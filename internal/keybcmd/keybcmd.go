@@ -9,12 +9,15 @@ import (
 	"fmt"
 	"io"
 	"os"
+	"strconv"
 	"strings"
+	"sync"
 
 	"github.com/rokath/trice/internal/emitter"
+	"github.com/rokath/trice/internal/id"
 )
 
-func loopAction(reader *bufio.Reader, target io.Writer, ipa, ipp string) {
+func loopAction(reader *bufio.Reader, target io.Writer, ipa, ipp string, lu id.TriceIDLookUp, m *sync.RWMutex) {
 	fmt.Print("-> ")
 	text, _ := reader.ReadString('\n')
 	text = strings.Replace(text, "\r", "", -1) // Windows "\r\n" !
@@ -31,28 +34,70 @@ func loopAction(reader *bufio.Reader, target io.Writer, ipa, ipp string) {
 		fmt.Println("h|help      - this text")
 		fmt.Println("sd|shutdown - kill trice display server (ends also this trice console)")
 		fmt.Println("q|quit      - end trice console (keeps the trice display server active)")
+		fmt.Println("off|on ch   - disable|enable all trices of channel ch on target, like 'off dbg'")
+		fmt.Println("off|on id   - disable|enable trice id on target, 'all' for all trices")
 		fmt.Println("Other commands are written to target.")
 	default:
-		fmt.Printf("Command '%s'\n", text)
-		b := append([]byte(text), 0)
-		target.Write(b)
+		cmds, err := idCommands(text, lu, m)
+		if err != nil {
+			fmt.Println(err)
+			return
+		}
+		for _, c := range cmds {
+			fmt.Printf("Command '%s'\n", c)
+			b := append([]byte(c), 0)
+			target.Write(b)
+		}
+	}
+}
+
+// idCommands converts "off x" and "on x" into the target ID commands "@-id" and "@+id".
+// x is a trice ID, a channel like "dbg" or "all". Other text is returned unchanged as single command.
+// The target needs TRICE_ID_BITMAP_BITS for the ID commands.
+func idCommands(text string, lu id.TriceIDLookUp, m *sync.RWMutex) ([]string, error) {
+	f := strings.Fields(text)
+	if len(f) != 2 || (f[0] != "off" && f[0] != "on") {
+		return []string{text}, nil
+	}
+	prefix := "@+"
+	if f[0] == "off" {
+		prefix = "@-"
+	}
+	if f[1] == "all" {
+		return []string{prefix}, nil
+	}
+	if n, err := strconv.Atoi(f[1]); err == nil {
+		return []string{prefix + strconv.Itoa(n)}, nil
+	}
+	m.RLock()
+	ids := lu.ChannelIDs(f[1])
+	m.RUnlock()
+	if len(ids) == 0 {
+		return nil, fmt.Errorf("no trice IDs for channel '%s'", f[1])
+	}
+	cmds := make([]string, len(ids))
+	for i, x := range ids {
+		cmds[i] = prefix + strconv.Itoa(int(x))
 	}
+	return cmds, nil
 }
 
 // ReadInput expects user input from terminal
-func ReadInput(target io.Writer) { // https://tutorialedge.net/golang/reading-console-input-golang/
+//
+// lu and m are used to find the trice IDs of a channel.
+func ReadInput(target io.Writer, lu id.TriceIDLookUp, m *sync.RWMutex) { // https://tutorialedge.net/golang/reading-console-input-golang/
 	reader := bufio.NewReader(os.Stdin)
-	keyboardInput(reader, target)
+	keyboardInput(reader, target, lu, m)
 }
 
 // keyboardInput expects input from reader
-func keyboardInput(reader *bufio.Reader, target io.Writer) { // https://tutorialedge.net/golang/reading-console-input-golang/
+func keyboardInput(reader *bufio.Reader, target io.Writer, lu id.TriceIDLookUp, m *sync.RWMutex) { // https://tutorialedge.net/golang/reading-console-input-golang/
 	fmt.Println("Simple Shell (try 'help'):")
 	fmt.Println("--------------------------")
 
 	go func() {
 		for {
-			loopAction(reader, target, emitter.IPAddr, emitter.IPPort)
+			loopAction(reader, target, emitter.IPAddr, emitter.IPPort, lu, m)
 		}
 	}() // https://stackoverflow.com/questions/16008604/why-add-after-closure-body-in-golang
 }
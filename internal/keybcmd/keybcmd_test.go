@@ -4,11 +4,43 @@
 // white-box test
 package keybcmd
 
-import "testing"
+import (
+	"sync"
+	"testing"
+
+	"github.com/rokath/trice/internal/id"
+	"github.com/tj/assert"
+)
 
 func TestDummy(t *testing.T) {
 }
 
+// TestIDCommands checks the conversion of on/off commands into target ID commands.
+func TestIDCommands(t *testing.T) {
+	lu := id.TriceIDLookUp{
+		58755: {Type: "TRICE0", Strg: "dbg:a\\n"},
+		1200:  {Type: "TRICE0", Strg: "dbg:b\\n"},
+		4711:  {Type: "TRICE0", Strg: "msg:c\\n"},
+	}
+	m := new(sync.RWMutex)
+	for _, x := range []struct {
+		text string
+		exp  []string
+	}{
+		{"off dbg", []string{"@-1200", "@-58755"}},
+		{"on msg", []string{"@+4711"}},
+		{"off 17", []string{"@-17"}},
+		{"on all", []string{"@+"}},
+		{"reset", []string{"reset"}},
+	} {
+		act, err := idCommands(x.text, lu, m)
+		assert.Nil(t, err)
+		assert.Equal(t, x.exp, act)
+	}
+	_, err := idCommands("off err", lu, m)
+	assert.NotNil(t, err)
+}
+
 //  // stimulate injects keys to the loop action and returns the captured output as byte slice.
 //  func stimulate(keys, ipa, ipp string) []byte {
 //
@@ -71,6 +71,12 @@ var (
 	// DefaultFileArgs replaces "default" args value for FILE port.
 	DefaultFileArgs = "trices.raw"
 
+	// DefaultUNIXArgs replaces "default" args value for UNIX port.
+	DefaultUNIXArgs = "/tmp/trice.sock"
+
+	// DefaultSHMArgs replaces "default" args value for SHM port.
+	DefaultSHMArgs = "/trice"
+
 	// DefaultBUFFERArgs replaces "default" args value for BUFFER port.
 	DefaultBUFFERArgs = "0 0 0 0"
 
@@ -206,6 +212,63 @@ func (p *file) Close() error {
 	return p.fh.Close()
 }
 
+// unixSocket holds a Unix domain socket listener and the connection of the target writing into it.
+type unixSocket struct {
+	w    io.Writer // os.Stdout
+	path string
+	ln   net.Listener
+	conn net.Conn
+}
+
+// newUnixSocket returns a readCloser capable unixSocket instance listening on path.
+// A socket file left over at path from a previous run is removed first.
+func newUnixSocket(_ io.Writer, path string) *unixSocket {
+	if fi, err := os.Lstat(path); err == nil && fi.Mode()&os.ModeSocket != 0 {
+		os.Remove(path)
+	}
+	ln, err := net.Listen("unix", path)
+	if err != nil {
+		log.Fatal(path, err)
+	}
+	return &unixSocket{path: path, ln: ln}
+}
+
+// Read is part of the exported interface io.ReadCloser. It reads a slice of bytes.
+// It waits for a target connection and, after the target closed it, for the next one. So a restarted target continues the log.
+func (p *unixSocket) Read(b []byte) (n int, err error) {
+	for {
+		if p.conn == nil {
+			if p.conn, err = p.ln.Accept(); err != nil {
+				return
+			}
+		}
+		n, err = p.conn.Read(b)
+		if err != io.EOF {
+			return
+		}
+		p.conn.Close()
+		p.conn = nil
+		if n > 0 {
+			return n, nil
+		}
+	}
+}
+
+func (p *unixSocket) Write(b []byte) (int, error) {
+	return len(b), nil // discard, the target only writes
+}
+
+// Close is part of the exported interface io.ReadCloser. It ends the connection and removes the socket file.
+func (p *unixSocket) Close() error {
+	if Verbose {
+		fmt.Fprintln(p.w, "Closing unix socket", p.path)
+	}
+	if p.conn != nil {
+		p.conn.Close()
+	}
+	return p.ln.Close() // removes the socket file too
+}
+
 // NewReadWriteCloser returns a ReadCloser for the specified port and its args.
 // err is nil on successful open.
 // When port is "COMn" args can be used to be "TARM" to use a different driver for dynamic testing.
@@ -213,7 +276,12 @@ func (p *file) Close() error {
 // When port is "BUFFER", args is expected to be a decimal byte sequence in the same format as for example coming from one of the other ports.
 // When port is "JLINK" args contains JLinkRTTLogger.exe specific parameters described inside UM08001_JLink.pdf.
 // When port is "STLINK" args has the same format as for "JLINK"
+// When port is "UNIX" args is the Unix domain socket path, a target like a TRICE_LINUX service connects to.
+// When port is "SHM:name" or "SHM" args is the shared memory object name like "/trice", a TRICE_LINUX service writes into.
 func NewReadWriteCloser(w io.Writer, verbose bool, port, args string) (r io.ReadWriteCloser, err error) {
+	if strings.HasPrefix(strings.ToUpper(port), "SHM:") {
+		port, args = port[:3], port[4:]
+	}
 	switch strings.ToUpper(port) {
 
 	case "JLINK", "STLINK", "J-LINK", "ST-LINK":
@@ -236,6 +304,16 @@ func NewReadWriteCloser(w io.Writer, verbose bool, port, args string) (r io.Read
 			PortArguments = DefaultFileArgs
 		}
 		r = newFileReader(w, args)
+	case "UNIX":
+		if PortArguments == "" { // nothing assigned in args
+			PortArguments = DefaultUNIXArgs
+		}
+		r = newUnixSocket(w, args)
+	case "SHM":
+		if PortArguments == "" { // nothing assigned in args
+			PortArguments = DefaultSHMArgs
+		}
+		r = newSHM(w, args)
 	case "DUMP":
 		if PortArguments == "" { // nothing assigned in args
 			PortArguments = DefaultDumpArgs
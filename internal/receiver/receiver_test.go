@@ -6,8 +6,10 @@ package receiver
 import (
 	"fmt"
 	"io"
+	"io/ioutil"
 	"net"
 	"os"
+	"path/filepath"
 	"testing"
 
 	"github.com/tj/assert"
@@ -67,6 +69,35 @@ func TestFILEReceiver(t *testing.T) {
 	rc.Close()
 }
 
+func TestUNIXReceiver(t *testing.T) {
+	dir, err := ioutil.TempDir("", "unix")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	fn := filepath.Join(dir, "trice.sock")
+	var verbose bool
+	rc, err := NewReadWriteCloser(os.Stdout, verbose, "UNIX", fn)
+	assert.Nil(t, err)
+	go func() { // a target restart: 2 connections one after the other
+		for _, d := range [][]byte{{1, 2, 3}, {4, 5}} {
+			c, err := net.Dial("unix", fn)
+			if err != nil {
+				return
+			}
+			c.Write(d)
+			c.Close()
+		}
+	}()
+	var b []byte
+	for len(b) < 5 {
+		c := make([]byte, 100)
+		n, err := rc.Read(c)
+		assert.Nil(t, err)
+		b = append(b, c[:n]...)
+	}
+	assert.Equal(t, []byte{1, 2, 3, 4, 5}, b)
+	assert.Nil(t, rc.Close())
+}
+
 // TestTCP4Receiver works, but fails when tested with -race
 func _TestTCP4Receiver(t *testing.T) {
 	var addr net.Addr
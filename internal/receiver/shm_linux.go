@@ -0,0 +1,129 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package receiver
+
+// shared memory ring input from a TRICE_LINUX target writing with TriceLinuxOpen("shm:/name")
+
+import (
+	"errors"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync/atomic"
+	"syscall"
+	"time"
+	"unsafe"
+)
+
+const (
+	shmMagic      = 0x53484d31 // shmMagic is TRICE_SHM_MAGIC.
+	shmWrOffset   = 64         // shmWrOffset is the byte offset of the target write count inside triceShm_t.
+	shmRdOffset   = 128        // shmRdOffset is the byte offset of the trice tool read count inside triceShm_t.
+	shmDataOffset = 192        // shmDataOffset is the byte offset of the ring data inside triceShm_t.
+)
+
+var (
+	// ShmPoll is the wait time, when the shared memory ring is empty or not created yet.
+	ShmPoll = time.Millisecond
+
+	// errShmNotReady is returned, as long as the target has not initialized the shared memory ring.
+	errShmNotReady = errors.New("shared memory ring not initialized")
+)
+
+// shm holds a shared memory ring mapping. The target writes only wr and the data, shm writes only rd.
+type shm struct {
+	w    io.Writer // os.Stdout
+	name string
+	mem  []byte
+	size uint32
+	wr   *uint32
+	rd   *uint32
+}
+
+// newSHM returns a readCloser capable shm instance for the shared memory object name like "/trice".
+// It maps the ring on the first Read, so trice can start before the target.
+func newSHM(w io.Writer, name string) *shm {
+	return &shm{w: w, name: name}
+}
+
+// open maps the shared memory ring, when the target initialized it.
+func (p *shm) open() error {
+	f, err := os.OpenFile(filepath.Join("/dev/shm", strings.TrimPrefix(p.name, "/")), os.O_RDWR, 0)
+	if err != nil {
+		return err
+	}
+	defer f.Close()
+	fi, err := f.Stat()
+	if err != nil {
+		return err
+	}
+	if fi.Size() < shmDataOffset {
+		return errShmNotReady
+	}
+	mem, err := syscall.Mmap(int(f.Fd()), 0, int(fi.Size()), syscall.PROT_READ|syscall.PROT_WRITE, syscall.MAP_SHARED)
+	if err != nil {
+		return err
+	}
+	size := *(*uint32)(unsafe.Pointer(&mem[4]))
+	if atomic.LoadUint32((*uint32)(unsafe.Pointer(&mem[0]))) != shmMagic || size&(size-1) != 0 || int64(size)+shmDataOffset != fi.Size() {
+		syscall.Munmap(mem)
+		return errShmNotReady
+	}
+	p.mem = mem
+	p.size = size
+	p.wr = (*uint32)(unsafe.Pointer(&mem[shmWrOffset]))
+	p.rd = (*uint32)(unsafe.Pointer(&mem[shmRdOffset]))
+	if Verbose {
+		fmt.Fprintln(p.w, "Mapped shared memory ring", p.name, "with", size, "bytes")
+	}
+	return nil
+}
+
+// Read is part of the exported interface io.ReadCloser. It reads a slice of bytes.
+// It copies the written bytes straight from the mapped ring into b and waits ShmPoll, while there are none.
+func (p *shm) Read(b []byte) (n int, err error) {
+	for p.mem == nil {
+		if err = p.open(); err != nil && err != errShmNotReady && !os.IsNotExist(err) {
+			return
+		}
+		if p.mem == nil {
+			time.Sleep(ShmPoll)
+		}
+	}
+	for {
+		rd := atomic.LoadUint32(p.rd)
+		count := atomic.LoadUint32(p.wr) - rd
+		if count == 0 {
+			time.Sleep(ShmPoll)
+			continue
+		}
+		if count > uint32(len(b)) {
+			count = uint32(len(b))
+		}
+		data := p.mem[shmDataOffset:]
+		n = copy(b[:count], data[rd&(p.size-1):])
+		n += copy(b[n:count], data)
+		atomic.StoreUint32(p.rd, rd+uint32(n)) // the target can reuse the space now
+		return n, nil
+	}
+}
+
+func (p *shm) Write(b []byte) (int, error) {
+	return len(b), nil // discard, the target only writes
+}
+
+// Close is part of the exported interface io.ReadCloser. It unmaps the ring, which stays for the target.
+func (p *shm) Close() error {
+	if Verbose {
+		fmt.Fprintln(p.w, "Closing shared memory ring", p.name)
+	}
+	if p.mem == nil {
+		return nil
+	}
+	err := syscall.Munmap(p.mem)
+	p.mem = nil
+	return err
+}
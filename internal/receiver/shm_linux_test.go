@@ -0,0 +1,41 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package receiver
+
+import (
+	"encoding/binary"
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+// TestSHMReceiver writes a shared memory ring like a TRICE_LINUX target with a wrapping write and reads it.
+func TestSHMReceiver(t *testing.T) {
+	name := fmt.Sprintf("/trice-test-%d", os.Getpid())
+	fn := "/dev/shm" + name
+	defer os.Remove(fn)
+	mem := make([]byte, shmDataOffset+16)
+	binary.LittleEndian.PutUint32(mem[0:], shmMagic)
+	binary.LittleEndian.PutUint32(mem[4:], 16)
+	binary.LittleEndian.PutUint32(mem[shmWrOffset:], 3) // 5 bytes written at the ring end and start across the counter wrap
+	binary.LittleEndian.PutUint32(mem[shmRdOffset:], 0xfffffffe)
+	copy(mem[shmDataOffset:], []byte{3, 4, 5})
+	copy(mem[shmDataOffset+14:], []byte{1, 2})
+	assert.Nil(t, ioutil.WriteFile(fn, mem, 0644))
+
+	var verbose bool
+	rc, err := NewReadWriteCloser(os.Stdout, verbose, "SHM:"+name, "")
+	assert.Nil(t, err)
+	b := make([]byte, 100)
+	n, err := rc.Read(b)
+	assert.Nil(t, err)
+	assert.Equal(t, []byte{1, 2, 3, 4, 5}, b[:n])
+	assert.Nil(t, rc.Close())
+	mem, err = ioutil.ReadFile(fn)
+	assert.Nil(t, err)
+	assert.Equal(t, uint32(3), binary.LittleEndian.Uint32(mem[shmRdOffset:]))
+}
@@ -0,0 +1,34 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+//go:build !linux
+// +build !linux
+
+package receiver
+
+import (
+	"errors"
+	"io"
+)
+
+// shm is a shared memory ring input, which exists only on Linux.
+type shm struct{}
+
+// newSHM returns a shm instance failing on each Read, because TRICE_LINUX shared memory rings exist only on Linux.
+func newSHM(_ io.Writer, _ string) *shm {
+	return &shm{}
+}
+
+// Read is part of the exported interface io.ReadCloser.
+func (p *shm) Read(b []byte) (int, error) {
+	return 0, errors.New("port SHM is supported only on Linux")
+}
+
+func (p *shm) Write(b []byte) (int, error) {
+	return len(b), nil
+}
+
+// Close is part of the exported interface io.ReadCloser.
+func (p *shm) Close() error {
+	return nil
+}
@@ -8,6 +8,7 @@ package cipher
 
 import (
 	"crypto/sha1"
+	"encoding/binary"
 	"fmt"
 	"io"
 
@@ -23,6 +24,9 @@ var (
 	// ShowKey if set, allows to see the encryption passphrase
 	ShowKey bool
 
+	// Mode is the decrypt mode: "ECB" decrypts each 8 byte block, "CTR" uses a keystream.
+	Mode = "ECB"
+
 	key []byte
 
 	// cipher is a pointer to the crypto struct filled during initialization
@@ -34,6 +38,9 @@ var (
 
 // SetUp uses the Password to create a cipher. If Password is "" encryption/decryption is disabled.
 func SetUp(w io.Writer) error {
+	if Mode != "ECB" && Mode != "CTR" {
+		return fmt.Errorf("unknown cipher mode %q, use ECB or CTR", Mode)
+	}
 	var err error
 	ci, enabled, err = createCipher(w)
 	msg.FatalOnErr(err)
@@ -151,6 +158,40 @@ func Decrypt(dst, src []byte) (c int) {
 	return
 }
 
+// keystream8 writes the keystream block for counter c and nonce into ks.
+//
+// The target enciphers the 32-bit words c and nonce and XORs the results with its little endian data words.
+func keystream8(ks []byte, c, nonce uint32) {
+	var src [8]byte
+	binary.BigEndian.PutUint32(src[:], c) // xtea assumes network order
+	binary.BigEndian.PutUint32(src[4:], nonce)
+	ci.Encrypt(ks, src[:])
+	copy(ks, swap8Bytes(ks)) // NtoH
+}
+
+// DecryptCTR converts a counter mode encrypted package src into dst and returns the count of converted bytes.
+//
+// The first 8 bytes of src are the keystream counter and nonce of the target, dst gets the decrypted bytes after them.
+// dst and src can be the same slice. The src len needs to be a multiple of 4.
+func DecryptCTR(dst, src []byte) (n int) {
+	if len(src) < 8 {
+		return
+	}
+	c := binary.LittleEndian.Uint32(src)
+	nonce := binary.LittleEndian.Uint32(src[4:])
+	src = src[8:]
+	ks := make([]byte, 8)
+	for i := 0; i < len(src) && i < len(dst); i++ {
+		if i&7 == 0 {
+			keystream8(ks, c, nonce)
+			c++
+		}
+		dst[i] = src[i] ^ ks[i&7]
+		n++
+	}
+	return
+}
+
 //  // Encrypt converts src into dst and returns count of converted bytes.
 //  // Only multiple of 8 are convertable, so last 0-7 bytes are not convertable and c is a multiple of 8.
 //  // The smaller byte slice limits the conversion.
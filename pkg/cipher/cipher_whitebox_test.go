@@ -66,3 +66,46 @@ func checkSmall(t *testing.T) {
 	decrypt8(dst, enc)
 	assert.Equal(t, src, dst)
 }
+
+func TestDecryptCTR(t *testing.T) {
+	Password = "aSecret"
+	assert.Nil(t, SetUp(os.Stdout))
+	src := []byte{7, 6, 5, 4, 3, 2, 1, 0, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0xff, 0xfe}
+	enc := append([]byte{0x10, 0, 0, 0, 4, 3, 2, 1}, src...) // counter 16, nonce 0x01020304
+	ks := make([]byte, 8)
+	for i := range src {
+		if i&7 == 0 {
+			keystream8(ks, 0x10+uint32(i>>3), 0x01020304)
+		}
+		enc[8+i] ^= ks[i&7]
+	}
+	dst := make([]byte, len(src))
+	assert.Equal(t, len(src), DecryptCTR(dst, enc))
+	assert.Equal(t, src, dst)
+	assert.Equal(t, len(src), DecryptCTR(enc, enc)) // in place
+	assert.Equal(t, src, enc[:len(src)])
+}
+
+func TestUnknownMode(t *testing.T) {
+	Mode = "CBC"
+	defer func() { Mode = "ECB" }()
+	assert.NotNil(t, SetUp(os.Stdout))
+}
+
+func BenchmarkDecrypt64(b *testing.B) {
+	Password = "aSecret"
+	SetUp(os.Stdout)
+	buf := make([]byte, 64)
+	for i := 0; i < b.N; i++ {
+		Decrypt(buf, buf)
+	}
+}
+
+func BenchmarkDecryptCTR64(b *testing.B) {
+	Password = "aSecret"
+	SetUp(os.Stdout)
+	buf := make([]byte, 72)
+	for i := 0; i < b.N; i++ {
+		DecryptCTR(buf[8:], buf)
+	}
+}
@@ -0,0 +1,43 @@
+/*! \file cores.c
+\brief trice.c compiled with one ring for each core and writer threads as cores for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "cores.h"
+
+uint32_t coresClock = 0;
+__thread unsigned coresThread = 0;
+
+static int coresCount; //!< coresCount is the trice count of each writer thread.
+
+//! coresWriter writes coresCount trices with its thread number and a sequence number into the ring of its thread.
+static void* coresWriter( void* arg ){
+    coresThread = (unsigned)(intptr_t)arg;
+    for( int i = 0; i < coresCount; i++ ){
+        TRICE32_2( Id(1002), "msg:%d %d\n", coresThread, i );
+    }
+    return arg;
+}
+
+//! CoresOpen calls TriceLinuxOpen and returns 0 or errno.
+int CoresOpen( char const* path ){
+    return TriceLinuxOpen( path ) ? errno : 0;
+}
+
+//! CoresClose calls TriceLinuxClose.
+void CoresClose( void ){
+    TriceLinuxClose();
+}
+
+//! CoresThreads runs TRICE_RING_CORES writer threads with count trices each concurrently and returns the count of trices dropped until now.
+unsigned CoresThreads( int count ){
+    pthread_t t[TRICE_RING_CORES];
+    coresCount = count;
+    for( int i = 0; i < TRICE_RING_CORES; i++ ){
+        pthread_create( &t[i], 0, coresWriter, (void*)(intptr_t)i );
+    }
+    for( int i = 0; i < TRICE_RING_CORES; i++ ){
+        pthread_join( t[i], 0 );
+    }
+    return TriceRingDropped();
+}
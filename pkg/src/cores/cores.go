@@ -0,0 +1,30 @@
+// Package cores tests the TRICE_RING_CORES rings on the host.
+// The target C-code is compiled with a local triceConfig.h and 4 writer threads, each using the ring of its thread number.
+package cores
+
+// #include <stdint.h>
+// #include <stdlib.h>
+// #include "cores.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+// #cgo LDFLAGS: -lpthread -lrt
+import "C"
+import (
+	"unsafe"
+)
+
+// open starts the trice output into path and returns the C errno value.
+func open(path string) int {
+	p := C.CString(path)
+	defer C.free(unsafe.Pointer(p))
+	return int(C.CoresOpen(p))
+}
+
+// close writes the remaining trices and ends the output.
+func close() {
+	C.CoresClose()
+}
+
+// threads runs 4 writer threads with count trices each and returns the dropped trices count.
+func threads(count int) int {
+	return int(C.CoresThreads(C.int(count)))
+}
@@ -0,0 +1,10 @@
+/*! \file cores.h
+\brief TRICE_RING_CORES interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int CoresOpen( char const* path );
+void CoresClose( void );
+unsigned CoresThreads( int count );
@@ -0,0 +1,48 @@
+package cores
+
+import (
+	"encoding/binary"
+	"io/ioutil"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestCores checks that each package carries the trices of one core with the core number in its descriptor
+// and that each core has its own cycle counter.
+func TestCores(t *testing.T) {
+	dir, err := ioutil.TempDir("", "cores")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	fn := filepath.Join(dir, "trice.bin")
+	assert.Equal(t, 0, open(fn))
+	assert.Equal(t, 0, threads(2000))
+	close()
+	b, err := ioutil.ReadFile(fn)
+	assert.Nil(t, err)
+	cycle := [4]uint8{0xc0, 0xc0, 0xc0, 0xc0}
+	var next [4]uint32
+	timestamps := make(map[uint32]bool)
+	for _, d := range tricetest.Packages(t, b) {
+		descriptor := binary.LittleEndian.Uint32(d)
+		core := descriptor >> 8
+		assert.True(t, core < 4)
+		assert.Equal(t, 1|64|core<<8, descriptor) // timestamps and core flag
+		for d = d[4:]; len(d) >= 16; d = d[16:] {
+			timestamps[binary.LittleEndian.Uint32(d)] = true
+			head := binary.LittleEndian.Uint32(d[4:])
+			assert.Equal(t, uint32(1002<<16|2<<8), head&^0xff)
+			assert.Equal(t, cycle[core], uint8(head))
+			cycle[core]++
+			assert.Equal(t, core, binary.LittleEndian.Uint32(d[8:]))
+			assert.Equal(t, next[core], binary.LittleEndian.Uint32(d[12:]))
+			next[core]++
+		}
+		assert.Equal(t, 0, len(d))
+	}
+	assert.Equal(t, [4]uint32{2000, 2000, 2000, 2000}, next)
+	assert.Equal(t, 8000, len(timestamps))
+}
@@ -0,0 +1,29 @@
+/*! \file delta.c
+\brief trice.c compiled with delta timestamps and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "delta.h"
+
+static uint32_t time = 0; //!< time is the mocked timestamp.
+
+//! ReadTime returns the timestamp set with SetTime.
+uint32_t ReadTime( void ){
+    return time;
+}
+
+//! SetTime sets the mocked timestamp.
+void SetTime( uint32_t t ){
+    time = t;
+}
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! TriceValues writes a single trice with values v and w into the trice buffer.
+void TriceValues( int v, int w ){
+    TRICE32_2( Id(58756), "rd:TRICE32_2 line %d, %d\n", v, w );
+}
@@ -0,0 +1,38 @@
+// Package delta tests the delta timestamp compaction on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package delta
+
+// #include <stdint.h>
+// #include "delta.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// setTime sets the target timestamp for the following trices.
+func setTime(t uint32) {
+	C.SetTime(C.uint32_t(t))
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// triceValues writes a single trice with values v and w.
+func triceValues(v, w int) {
+	C.TriceValues(C.int(v), C.int(w))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,12 @@
+/*! \file delta.h
+\brief delta timestamp mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void SetTime( uint32_t t );
+void TriceValue( int v );
+void TriceValues( int v, int w );
+void TriceTransfer( void );
@@ -0,0 +1,48 @@
+package delta
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestDeltaTimestamps checks the package timestamp, the 16- and 32-bit deltas and the padding.
+func TestDeltaTimestamps(t *testing.T) {
+	setTime(0x12340000)
+	triceValue(1)
+	setTime(0x12340010)
+	triceValues(2, 3)
+	setTime(0x12350000) // delta 0xfff0 needs 32 bits
+	triceValue(4)
+	setTime(0x12350005)
+	triceValue(5)
+	triceTransfer()
+	exp := []byte{
+		5, 0, 0, 0, // descriptor: delta timestamps
+		0x00, 0x00, 0x34, 0x12, // package timestamp
+		0x00, 0x00, 0xc0, 0x01, 0x83, 0xe5, 1, 0, 0, 0, // delta 0
+		0x10, 0x00, 0xc1, 0x02, 0x84, 0xe5, 2, 0, 0, 0, 3, 0, 0, 0, // delta 0x10
+		0x00, 0x80, 0xf0, 0xff, 0xc2, 0x01, 0x83, 0xe5, 4, 0, 0, 0, // delta 0x0000fff0
+		0x05, 0x00, 0xc3, 0x01, 0x83, 0xe5, 5, 0, 0, 0, // delta 5
+		0, 0, // padding
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
+
+// TestDeltaBackwards checks the signed 31-bit delta of a timestamp stepping backwards.
+func TestDeltaBackwards(t *testing.T) {
+	setTime(0x100)
+	triceValue(1)
+	setTime(0xf0)
+	triceValue(2)
+	triceTransfer()
+	exp := []byte{
+		5, 0, 0, 0, // descriptor: delta timestamps
+		0x00, 0x01, 0x00, 0x00, // package timestamp
+		0x00, 0x00, 0xc4, 0x01, 0x83, 0xe5, 1, 0, 0, 0, // delta 0
+		0xff, 0xff, 0xf0, 0xff, 0xc5, 0x01, 0x83, 0xe5, 2, 0, 0, 0, // delta -0x10
+		0, 0, // padding
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
@@ -0,0 +1,25 @@
+/*! \file triceConfig.h
+\brief trice configuration for the delta timestamp host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+extern uint32_t ReadTime( void );
+#define TRICE_TIMESTAMP ReadTime() //!< ReadTime is mocked in delta.c.
+#define TRICE_DELTA_TIMESTAMP //!< One absolute timestamp per package and a delta per trice.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,13 @@
+/*! \file fragment.c
+\brief trice.c compiled with fragmented TRICE_N and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "trice.h"
+#include "fragment.h"
+
+//! TriceBuffer writes len bytes from buf with TRICE_N.
+void TriceBuffer( uint8_t const* buf, unsigned len ){
+    TRICE_N( Id(1201), "msg:%s\n", buf, len );
+}
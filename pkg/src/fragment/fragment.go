@@ -0,0 +1,28 @@
+// Package fragment tests the fragmented TRICE_N streaming on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package fragment
+
+// #include <stdint.h>
+// #include "fragment.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceBuffer writes b with TRICE_N.
+func triceBuffer(b []byte) {
+	C.TriceBuffer((*C.uint8_t)(unsafe.Pointer(&b[0])), C.unsigned(len(b)))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
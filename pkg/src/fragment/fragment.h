@@ -0,0 +1,10 @@
+/*! \file fragment.h
+\brief fragmented TRICE_N mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceBuffer( uint8_t const* buf, unsigned len );
+void TriceTransfer( void );
@@ -0,0 +1,41 @@
+package fragment
+
+import (
+	"encoding/binary"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestFragments checks, that a buffer bigger than TRICE_SINGLE_MAX_SIZE is streamed as fragments over several packages.
+func TestFragments(t *testing.T) {
+	buf := make([]byte, 300)
+	for i := range buf {
+		buf[i] = byte(i * 7)
+	}
+	triceBuffer(buf)
+	triceTransfer()
+	triceTransfer()
+	triceTransfer()
+
+	var got []byte
+	var pkgs, last int
+	for _, d := range tricetest.Packages(t, written()) {
+		pkgs++
+		for d = d[4:]; len(d) >= 12; d = d[4+4*int(d[1]):] {
+			assert.Equal(t, uint16(1201), binary.LittleEndian.Uint16(d[2:]))
+			length := binary.LittleEndian.Uint32(d[4:])
+			assert.Equal(t, uint32(0x80000000), length&0x80ff0000) // fragment of transfer 0
+			assert.Equal(t, uint32(len(got)), binary.LittleEndian.Uint32(d[8:]))
+			count := int(length & 0xffff)
+			got = append(got, d[12:12+count]...)
+			if length&0x40000000 != 0 {
+				last++
+			}
+		}
+	}
+	assert.Equal(t, buf, got)
+	assert.Equal(t, 1, last)
+	assert.True(t, pkgs > 1)
+}
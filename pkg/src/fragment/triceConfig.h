@@ -0,0 +1,25 @@
+/*! \file triceConfig.h
+\brief trice configuration for the fragmented TRICE_N host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_FRAGMENTS //!< Buffers bigger than a single trice are streamed as fragments.
+
+#define TRICE_WRITE_MOCK_SIZE 1024 //!< The fragments of several transfers.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,25 @@
+/*! \file caller.c
+\brief TRICE macros calling the out-of-line TRICE functions for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#define TRICE_FILE Id(1400)
+#include "trice.h"
+#include "functions.h"
+
+//! TriceCalls writes the trices of TriceInline with the TRICE functions.
+void TriceCalls( int v ){
+    TRICE8_3( Id(1401), "msg:%d %d %d\n", v, -v, 3 );
+    TRICE16_1( Id(1402), "msg:%d\n", v );
+    TRICE32_2( Id(1403), "msg:%d %d\n", v, 7 );
+    TRICE64_1( Id(1404), "msg:%d\n", -v );
+    TRICE_S( Id(1405), "msg:%s\n", "text" );
+}
+
+//! BenchCalls writes n trices with the TRICE functions. The write position is set back after each trice.
+void BenchCalls( int n ){
+    uint32_t* start = TriceBufferWritePosition;
+    for( int i = 0; i < n; i++ ){
+        TRICE32_2( Id(1403), "msg:%d %d\n", i, 7 );
+        TriceBufferWritePosition = start;
+    }
+}
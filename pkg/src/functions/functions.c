@@ -0,0 +1,26 @@
+/*! \file functions.c
+\brief trice.c compiled with TRICE_FUNCTIONS and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "trice.h"
+#include "functions.h"
+
+//! TriceInline writes some trices with the inline TRICE macros of trice.c.
+void TriceInline( int v ){
+    TRICE8_3( Id(1401), "msg:%d %d %d\n", v, -v, 3 );
+    TRICE16_1( Id(1402), "msg:%d\n", v );
+    TRICE32_2( Id(1403), "msg:%d %d\n", v, 7 );
+    TRICE64_1( Id(1404), "msg:%d\n", -v );
+    TRICE_S( Id(1405), "msg:%s\n", "text" );
+}
+
+//! BenchInline writes n inline trices. The write position is set back after each trice.
+void BenchInline( int n ){
+    uint32_t* start = TriceBufferWritePosition;
+    for( int i = 0; i < n; i++ ){
+        TRICE32_2( Id(1403), "msg:%d %d\n", i, 7 );
+        TriceBufferWritePosition = start;
+    }
+}
@@ -0,0 +1,44 @@
+// Package functions tests the out-of-line TRICE functions on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+// functions.c uses the inline TRICE macros and caller.c the TRICE functions.
+package functions
+
+// #include <stdint.h>
+// #include "functions.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceInline writes some trices with value v using the inline macros.
+func triceInline(v int) {
+	C.TriceInline(C.int(v))
+}
+
+// triceCalls writes the same trices with value v using the TRICE functions.
+func triceCalls(v int) {
+	C.TriceCalls(C.int(v))
+}
+
+// benchInline writes n inline trices.
+func benchInline(n int) {
+	C.BenchInline(C.int(n))
+}
+
+// benchCalls writes n trices with the TRICE functions.
+func benchCalls(n int) {
+	C.BenchCalls(C.int(n))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,13 @@
+/*! \file functions.h
+\brief out-of-line TRICE function mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceInline( int v );
+void TriceCalls( int v );
+void BenchInline( int n );
+void BenchCalls( int n );
+void TriceTransfer( void );
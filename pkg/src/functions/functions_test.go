@@ -0,0 +1,44 @@
+package functions
+
+import (
+	"encoding/binary"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// trices returns the trices inside the only COBS package in b with cleared cycle counters and their locations.
+func trices(t *testing.T, b []byte) (r [][]byte, locations []uint32) {
+	d := tricetest.Package(t, b)
+	for d = d[4:]; len(d) >= 8; d = d[8+4*int(d[5]):] {
+		locations = append(locations, binary.LittleEndian.Uint32(d))
+		d[4] = 0
+		r = append(r, d[4:8+4*int(d[5])])
+	}
+	return
+}
+
+// TestFunctions checks, that the TRICE functions write the same trices as the inline macros with the location of the call site.
+func TestFunctions(t *testing.T) {
+	triceInline(-5)
+	triceTransfer()
+	exp, _ := trices(t, written())
+	assert.Equal(t, 5, len(exp))
+
+	triceCalls(-5)
+	triceTransfer()
+	act, locations := trices(t, written())
+	assert.Equal(t, exp, act)
+	assert.Equal(t, []uint32{1400<<16 | 11, 1400<<16 | 12, 1400<<16 | 13, 1400<<16 | 14, 1400<<16 | 15}, locations) // caller.c lines
+}
+
+// BenchmarkInline measures a TRICE32_2 expanded inline.
+func BenchmarkInline(b *testing.B) {
+	benchInline(b.N)
+}
+
+// BenchmarkFunctions measures a TRICE32_2 calling TriceCall32_2.
+func BenchmarkFunctions(b *testing.B) {
+	benchCalls(b.N)
+}
@@ -0,0 +1,24 @@
+/*! \file triceConfig.h
+\brief trice configuration for the out-of-line TRICE function host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_FUNCTIONS //!< The TRICE macros call shared functions instead of expanding inline.
+#define TRICE_LOCATION (TRICE_FILE| __LINE__) //!< The TRICE functions get the location from the call site.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
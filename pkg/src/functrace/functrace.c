@@ -0,0 +1,40 @@
+/*! \file functrace.c
+\brief trice.c compiled with function trace hooks, a clock mock and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "functrace.h"
+
+static uint32_t SpanClock = 0; //!< SpanClock is the TRICE_SPAN_CLOCK() value.
+static uint32_t isrFn = 0; //!< isrFn is the address of a function interrupting the next clock read or 0.
+static uint32_t isrClock = 0; //!< isrClock is the clock value on isrFn entry.
+
+//! SpanClockRead returns SpanClock and runs a pending interrupt function right after the clock read.
+uint32_t SpanClockRead( void ){
+    uint32_t clock = SpanClock;
+    if( isrFn ){
+        uint32_t fn = isrFn;
+        isrFn = 0;
+        TriceFunction( 1, fn, isrClock );
+        TriceFunction( 0, fn, isrClock + 10 );
+    }
+    return clock;
+}
+
+//! TriceFunction calls the enter or exit hook for function address fn at clock like instrumented code does.
+void TriceFunction( int enter, uint32_t fn, uint32_t clock ){
+    SpanClock = clock;
+    if( enter ){
+        __cyg_profile_func_enter( (void*)(uintptr_t)fn, 0 );
+    }else{
+        __cyg_profile_func_exit( (void*)(uintptr_t)fn, 0 );
+    }
+}
+
+//! TriceFunctionInterrupted calls the enter hook for fn at clock, which gets interrupted by function isr at clock isrAt.
+void TriceFunctionInterrupted( uint32_t fn, uint32_t clock, uint32_t isr, uint32_t isrAt ){
+    isrFn = isr;
+    isrClock = isrAt;
+    TriceFunction( 1, fn, clock );
+}
@@ -0,0 +1,37 @@
+// Package functrace tests the function trace hooks on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package functrace
+
+// #include <stdint.h>
+// #include "functrace.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceFunction calls the enter or exit hook for function address fn at clock.
+func triceFunction(enter bool, fn, clock uint32) {
+	var e C.int
+	if enter {
+		e = 1
+	}
+	C.TriceFunction(e, C.uint32_t(fn), C.uint32_t(clock))
+}
+
+// triceFunctionInterrupted calls the enter hook for fn at clock, which gets interrupted by function isr at clock isrAt.
+func triceFunctionInterrupted(fn, clock, isr, isrAt uint32) {
+	C.TriceFunctionInterrupted(C.uint32_t(fn), C.uint32_t(clock), C.uint32_t(isr), C.uint32_t(isrAt))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,11 @@
+/*! \file functrace.h
+\brief function trace mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceFunction( int enter, uint32_t fn, uint32_t clock );
+void TriceFunctionInterrupted( uint32_t fn, uint32_t clock, uint32_t isr, uint32_t isrAt );
+void TriceTransfer( void );
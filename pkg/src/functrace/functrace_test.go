@@ -0,0 +1,38 @@
+package functrace
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestFunctionTrace checks the function enter and exit control records with the lower half of their absolute clock values.
+// The host addresses are 64 bits wide, so the records carry both address halves.
+func TestFunctionTrace(t *testing.T) {
+	triceFunction(true, 0x08001001, 100)
+	triceFunction(false, 0x08001001, 150)
+	triceFunction(true, 0x08002001, 150+0x20000)
+	triceTransfer()
+	exp := []byte{
+		0, 0, 0, 0, // descriptor
+		0x16, 0xff, 100, 0, 0x01, 0x10, 0x00, 0x08, 0, 0, 0, 0, // enter at 100
+		0x1a, 0xff, 150, 0, 0x01, 0x10, 0x00, 0x08, 0, 0, 0, 0, // exit at 150
+		0x16, 0xff, 150, 0, 0x01, 0x20, 0x00, 0x08, 0, 0, 0, 0, // enter at 0x20096
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
+
+// TestFunctionTraceInterrupted checks an enter event interrupted right after its clock read.
+// The interrupt events come first and the interrupted event keeps its own clock value.
+func TestFunctionTraceInterrupted(t *testing.T) {
+	triceFunctionInterrupted(0x08003001, 1000, 0x08004001, 1005)
+	triceTransfer()
+	exp := []byte{
+		0, 0, 0, 0, // descriptor
+		0x16, 0xff, 0xed, 0x03, 0x01, 0x40, 0x00, 0x08, 0, 0, 0, 0, // isr enter at 1005
+		0x1a, 0xff, 0xf7, 0x03, 0x01, 0x40, 0x00, 0x08, 0, 0, 0, 0, // isr exit at 1015
+		0x16, 0xff, 0xe8, 0x03, 0x01, 0x30, 0x00, 0x08, 0, 0, 0, 0, // interrupted enter at 1000
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
@@ -0,0 +1,25 @@
+/*! \file triceConfig.h
+\brief trice configuration for the function trace host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_SPAN_CLOCK() SpanClockRead() //!< SpanClockRead returns the clock set by the host tests.
+#define TRICE_FUNCTION_TRACE //!< The host tests call the hooks directly.
+uint32_t SpanClockRead( void );
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,61 @@
+/*! \file harness.c
+\brief host simulation of a target running all TriceCheckSet indices
+\author Thomas.Hoehenleitner [at] seerose.net
+\details Compile it together with trice.c, triceCheck.c and tcobs.c for each TRICE_MODE, for example:
+gcc -O2 -I. -I.. -DTRICE_MODE=200 -DHARNESS_TIMESTAMP harness.c ../trice.c ../triceCheck.c ../tcobs.c -o harness
+"harness 100" runs all indices 100 times, writes the COBS packages to stdout and the encode time in ns to stderr.
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "trice.h"
+
+uint32_t harnessTime = 0;
+
+static uint8_t* harnessOut = 0; //!< harnessOut holds the bytes written with TRICE_WRITE.
+static size_t harnessLength = 0; //!< harnessLength is the byte count inside harnessOut.
+static size_t harnessCapacity = 0; //!< harnessCapacity is the harnessOut size.
+
+//! harnessWrite appends buf to harnessOut.
+void harnessWrite( uint8_t const * buf, unsigned len ){
+    if( harnessLength + len > harnessCapacity ){
+        harnessCapacity = 2*(harnessLength + len);
+        harnessOut = realloc( harnessOut, harnessCapacity );
+        if( !harnessOut ){
+            exit( 1 );
+        }
+    }
+    memcpy( harnessOut + harnessLength, buf, len );
+    harnessLength += len;
+}
+
+//! harnessTransfer writes out all trices like a cyclic TriceTransfer call in the target.
+static void harnessTransfer( void ){
+    #if defined(TRICE_HALF_BUFFER_SIZE)
+    TriceTransfer(); // swap and write
+    TriceTransfer(); // free the written slot
+    #elif defined(TRICE_RING_BUFFER_SIZE)
+    size_t length;
+    do{
+        length = harnessLength;
+        TriceTransfer();
+    }while( length != harnessLength );
+    #endif
+}
+
+//! main runs all TriceCheckSet indices argv[1] times.
+int main( int argc, char** argv ){
+    int rounds = argc > 1 ? atoi( argv[1] ) : 1;
+    struct timespec start, stop;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for( int r = 0; r < rounds; r++ ){
+        for( int index = 0; index <= 1000; index++ ){
+            TriceCheckSet( index );
+            harnessTransfer();
+        }
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    fwrite( harnessOut, 1, harnessLength, stdout );
+    fprintf( stderr, "%lld\n", (stop.tv_sec - start.tv_sec)*1000000000LL + stop.tv_nsec - start.tv_nsec );
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*! \file triceConfig.h
+\brief trice configuration for the host simulation of all predefined trice modes
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#ifndef TRICE_MODE
+#define TRICE_MODE 0 //! TRICE_MODE is a predefined trice transfer method. Select it with -DTRICE_MODE=200 for example.
+#endif
+
+#ifdef HARNESS_LOCATION
+#define TRICE_LOCATION (TRICE_FILE| __LINE__) //!< -DHARNESS_LOCATION adds the target location.
+#endif
+
+#ifdef HARNESS_TIMESTAMP
+extern uint32_t harnessTime; //!< harnessTime counts the timestamps.
+#define TRICE_TIMESTAMP (harnessTime++) //!< -DHARNESS_TIMESTAMP adds the target timestamp.
+#endif
+
+#if defined(HARNESS_LOCATION) && defined(HARNESS_TIMESTAMP)
+#define HARNESS_PREFIX_SIZE 8 //!< HARNESS_PREFIX_SIZE is the TRICE_PREFIX_SIZE.
+#elif defined(HARNESS_LOCATION) || defined(HARNESS_TIMESTAMP)
+#define HARNESS_PREFIX_SIZE 4 //!< HARNESS_PREFIX_SIZE is the TRICE_PREFIX_SIZE.
+#else
+#define HARNESS_PREFIX_SIZE 0 //!< HARNESS_PREFIX_SIZE is the TRICE_PREFIX_SIZE.
+#endif
+
+//! HARNESS_SINGLE_MAX_SIZE lets all modes and prefix options truncate the big TriceCheckSet buffers at the same length,
+//! so that they all decode to the same text.
+#define HARNESS_SINGLE_MAX_SIZE (800 + HARNESS_PREFIX_SIZE)
+
+//! TRICE_WRITE appends the COBS packages to the output memory in harness.c.
+#define TRICE_WRITE( buf, len ) do{ harnessWrite( buf, len ); }while(0)
+void harnessWrite( uint8_t const * buf, unsigned len );
+
+#if TRICE_MODE == 0 // direct output, TriceOut encodes inside the TRICE macro
+#define TRICE_STACK_BUFFER_MAX_SIZE 1024 //!< This is the stack buffer size for one TRICE including TRICE_DATA_OFFSET.
+#define TRICE_SINGLE_MAX_SIZE HARNESS_SINGLE_MAX_SIZE //!< TRICE_SINGLE_MAX_SIZE is the max allowed single trice size.
+#define TRICE_ENTER { /*! Start of TRICE macro */ \
+    uint32_t co[TRICE_STACK_BUFFER_MAX_SIZE>>2]; \
+    uint32_t* TriceBufferWritePosition = co + (TRICE_DATA_OFFSET>>2);
+#define TRICE_LEAVE { /*! End of TRICE macro */ \
+    unsigned tLen = ((TriceBufferWritePosition - co)<<2) - TRICE_DATA_OFFSET; \
+    TriceOut( co, tLen ); } }
+#endif // #if TRICE_MODE == 0
+
+#if TRICE_MODE == 200 // double buffer with cycle counter
+#define TRICE_ENTER TRICE_ENTER_CRITICAL_SECTION //! TRICE_ENTER is the start of TRICE macro.
+#define TRICE_LEAVE TRICE_LEAVE_CRITICAL_SECTION //! TRICE_LEAVE is the end of TRICE macro.
+#define TRICE_HALF_BUFFER_SIZE 0x2000 //!< This is the size of each of both buffers. It holds all trices of one TriceCheckSet index.
+#define TRICE_SINGLE_MAX_SIZE HARNESS_SINGLE_MAX_SIZE //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+#endif // #if TRICE_MODE == 200
+
+#if TRICE_MODE == 201 // double buffer without cycle counter
+#define TRICE_CYCLE_COUNTER 0 //! Do not add cycle counter.
+#define TRICE_ENTER //! TRICE_ENTER is the start of TRICE macro.
+#define TRICE_LEAVE //! TRICE_LEAVE is the end of TRICE macro.
+#define TRICE_HALF_BUFFER_SIZE 0x2000 //!< This is the size of each of both buffers. It holds all trices of one TriceCheckSet index.
+#define TRICE_SINGLE_MAX_SIZE HARNESS_SINGLE_MAX_SIZE //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+#endif // #if TRICE_MODE == 201
+
+#if TRICE_MODE == 300 // lock-free ring
+#define TRICE_RING_BUFFER_SIZE 0x4000 //!< This is the ring size. It holds all trices of one TriceCheckSet index.
+#define TRICE_RING_TRANSFER_SIZE 0x1000 //!< This is the max byte count moved out of the ring with one TriceTransfer.
+#define TRICE_SINGLE_MAX_SIZE HARNESS_SINGLE_MAX_SIZE //!< TRICE_SINGLE_MAX_SIZE is the stack buffer size for one TRICE.
+#define TRICE_ENTER { /*! Start of TRICE macro */ \
+    uint32_t co[TRICE_SINGLE_MAX_SIZE>>2]; \
+    uint32_t* TriceBufferWritePosition = co;
+#define TRICE_LEAVE { /*! End of TRICE macro */ \
+    TriceRingWrite( co, TriceBufferWritePosition - co ); } }
+#endif // #if TRICE_MODE == 300
+
+//! TriceOutDepth returns 0, because harnessWrite stores immediately.
+static inline int TriceOutDepth( void ){ return 0; }
+
+#define TRICE_INLINE static inline //! used for trice code
+
+#define ALIGN4                                  //!< align to 4 byte boundary preamble
+#define ALIGN4_END __attribute__ ((aligned(4))) //!< align to 4 byte boundary post declaration
+
+//! TRICE_ENTER_CRITICAL_SECTION is not needed in the single threaded harness.
+#define TRICE_ENTER_CRITICAL_SECTION {
+
+//! TRICE_LEAVE_CRITICAL_SECTION is not needed in the single threaded harness.
+#define TRICE_LEAVE_CRITICAL_SECTION }
+
+//! TRICE_CAS is the compare-and-swap used for the lock-free TRICE_RING_BUFFER_SIZE mode.
+#define TRICE_CAS( p, pExpected, desired ) __atomic_compare_exchange_n( (p), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __atomic_thread_fence( __ATOMIC_SEQ_CST )
+
+#define TRICE_1  TRICE32_1  //!< Default parameter bit width for 1  parameter count TRICE is 32.
+#define TRICE_2  TRICE32_2  //!< Default parameter bit width for 2  parameter count TRICE is 32.
+#define TRICE_3  TRICE32_3  //!< Default parameter bit width for 3  parameter count TRICE is 32.
+#define TRICE_4  TRICE32_4  //!< Default parameter bit width for 4  parameter count TRICE is 32.
+#define TRICE_5  TRICE32_5  //!< Default parameter bit width for 5  parameter count TRICE is 32.
+#define TRICE_6  TRICE32_6  //!< Default parameter bit width for 6  parameter count TRICE is 32.
+#define TRICE_7  TRICE32_7  //!< Default parameter bit width for 7  parameter count TRICE is 32.
+#define TRICE_8  TRICE32_8  //!< Default parameter bit width for 8  parameter count TRICE is 32.
+#define TRICE_9  TRICE32_9  //!< Default parameter bit width for 9  parameter count TRICE is 32.
+#define TRICE_10 TRICE32_10 //!< Default parameter bit width for 10 parameter count TRICE is 32.
+#define TRICE_11 TRICE32_11 //!< Default parameter bit width for 11 parameter count TRICE is 32.
+#define TRICE_12 TRICE32_12 //!< Default parameter bit width for 12 parameter count TRICE is 32.
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
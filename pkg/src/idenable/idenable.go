@@ -0,0 +1,41 @@
+// Package idenable tests the runtime trice ID enable bitmap on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package idenable
+
+// #include <stdint.h>
+// #include <stdlib.h>
+// #include "idenable.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// triceValues writes a single trice with values v and w.
+func triceValues(v, w int) {
+	C.TriceValues(C.int(v), C.int(w))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
+
+// idCommand calls TriceIdCommand with cmd and returns its result.
+func idCommand(cmd string) int {
+	s := C.CString(cmd)
+	defer C.free(unsafe.Pointer(s))
+	return int(C.TriceIdCommand(s))
+}
@@ -0,0 +1,12 @@
+/*! \file idenable.h
+\brief trice ID enable bitmap mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceValue( int v );
+void TriceValues( int v, int w );
+void TriceTransfer( void );
+int TriceIdCommand( char const* cmd );
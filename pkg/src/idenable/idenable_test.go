@@ -0,0 +1,43 @@
+package idenable
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestIDEnable checks disabling and enabling single and all trice IDs at runtime.
+func TestIDEnable(t *testing.T) {
+	triceValue(1)
+	triceValues(2, 3)
+	triceTransfer()
+	assert.Equal(t, []int{58755, 58756}, tricetest.IDs(t, written()))
+
+	assert.Equal(t, 1, idCommand("@-58755"))
+	triceValue(1)
+	triceValues(2, 3)
+	triceTransfer()
+	assert.Equal(t, []int{58756}, tricetest.IDs(t, written()))
+
+	assert.Equal(t, 1, idCommand("@+58755"))
+	assert.Equal(t, 1, idCommand("@-59780")) // 58756 + 1024 shares the bit of 58756
+	triceValue(1)
+	triceValues(2, 3)
+	triceTransfer()
+	assert.Equal(t, []int{58755}, tricetest.IDs(t, written()))
+
+	assert.Equal(t, 1, idCommand("@-"))
+	triceValue(1)
+	triceValues(2, 3)
+	triceTransfer()
+	assert.Equal(t, []int(nil), tricetest.IDs(t, written()))
+
+	assert.Equal(t, 1, idCommand("@+"))
+	assert.Equal(t, 0, idCommand("@-5x"))
+	assert.Equal(t, 0, idCommand("reset"))
+	triceValue(1)
+	triceValues(2, 3)
+	triceTransfer()
+	assert.Equal(t, []int{58755, 58756}, tricetest.IDs(t, written()))
+}
@@ -0,0 +1,23 @@
+/*! \file triceConfig.h
+\brief trice configuration for the trice ID enable bitmap host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_ID_BITMAP_BITS 1024 //!< Runtime enable bitmap for trice IDs.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -54,6 +54,11 @@ extern uint32_t ReadTime( void );
 // Enabling next 2 lines results in XTEA TriceEncryption  with the key.
 //#define TRICE_ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret
 //#define TRICE_DECRYPT //!< TRICE_DECRYPT is usually not needed. Enable for checks.
+//#define TRICE_ENCRYPT_CTR //!< Enable additionally for XTEA counter mode: call TriceKeystreamFill() in idle time. Needs "-cipherMode CTR" for the trice tool.
+//#define TRICE_CTR_NONCE BootCount //!< Needed for TRICE_ENCRYPT_CTR: a value changing with each reset, like a boot counter incremented in non-volatile memory at startup.
+
+//#define TRICE_TCOBS //!< Enable for TCOBS framing with run length compression. Needs "-encoding TCOBS" for the trice tool and tcobs.c added to the project.
+//#define TRICE_COBS_ENCODE TriceCOBSEncode32 //!< Enable for faster COBS encoding with 32-bit zero checks (more code). Output is identical.
 
 //#define TRICE_BIG_ENDIANNESS //!< TRICE_BIG_ENDIANNESS needs to be defined for TRICE64 macros on big endian devices. (Untested!)
 
@@ -110,6 +115,26 @@ extern uint32_t ReadTime( void );
 #define TRICE_SINGLE_MAX_SIZE 800 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
 #endif // #if TRICE_MODE == 201
 
+//! Lock-free ring buffer output to RTT or UART with cycle counter. Trices inside interrupts allowed without disabling them. Fast TRICE macro execution.
+//! Each TRICE is written into a small stack buffer and then copied into the ring after a compare-and-swap reservation.
+//! Needs TRICE_CAS and TRICE_MEMORY_BARRIER in the compiler adaption below.
+//! UART Command line similar to: `trice log -p COM1 -baud 115200`
+//! RTT Command line similar to: `trice l -args="-Device STM32G071RB -if SWD -Speed 4000 -RTTChannel 0 -RTTSearchRanges 0x20000000_0x1000"`
+#if TRICE_MODE == 300
+#define TRICE_RING_BUFFER_SIZE 2048 //!< This is the ring size. Must be a power of 2 and able to hold the max TRICE burst count within TRICE_TRANSFER_INTERVAL_MS.
+#define TRICE_RING_TRANSFER_SIZE 1024 //!< This is the max byte count moved out of the ring with one TriceTransfer. Must not exceed SEGGER BUFFER_SIZE_UP
+#define TRICE_SINGLE_MAX_SIZE 112 //!< TRICE_SINGLE_MAX_SIZE is the stack buffer size for one TRICE. Check TriceDepthMax at runtime.
+#ifndef TRICE_ENTER
+#define TRICE_ENTER { /*! Start of TRICE macro */ \
+    uint32_t co[TRICE_SINGLE_MAX_SIZE>>2]; \
+    uint32_t* TriceBufferWritePosition = co;
+#endif
+#ifndef TRICE_LEAVE
+#define TRICE_LEAVE { /*! End of TRICE macro */ \
+    TriceRingWrite( co, TriceBufferWritePosition - co ); } }
+#endif
+#endif // #if TRICE_MODE == 300
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -155,6 +180,12 @@ extern uint32_t ReadTime( void );
 //! TRICE_LEAVE_CRITICAL_SECTION restores interrupt state.
 #define TRICE_LEAVE_CRITICAL_SECTION } // to do
 
+//! TRICE_CAS replaces *p with desired and returns !0, if *p equals *pExpected. Otherwise it copies *p into *pExpected and returns 0.
+#define TRICE_CAS( p, pExpected, desired ) __atomic_compare_exchange_n( (p), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __atomic_thread_fence( __ATOMIC_SEQ_CST )
+
 #elif defined(__arm__) // ARMkeil IDE #########################################
 
 #include <cmsis_armcc.h>
@@ -182,6 +213,40 @@ extern uint32_t ReadTime( void );
 //! you can leave this macro pair empty for more speed. Use only '}' in that case.
 #define TRICE_LEAVE_CRITICAL_SECTION } __set_PRIMASK(primaskstate); }
 
+//! triceCAS replaces *p with desired and returns !0, if *p equals *pExpected. Otherwise it copies *p into *pExpected and returns 0.
+//! It could fail also spuriously, so use it only in a loop.
+#if defined( __ARM_ARCH_6M__ ) || defined( __TARGET_ARCH_6S_M ) // Cortex M0 and M0+ have no LDREX/STREX
+TRICE_INLINE int triceCAS( volatile uint32_t* p, uint32_t* pExpected, uint32_t desired ){
+    int done;
+    uint32_t primaskstate = __get_PRIMASK(); // only these few instructions run with disabled interrupts
+    __disable_irq();
+    done = *p == *pExpected;
+    if( done ){
+        *p = desired;
+    }else{
+        *pExpected = *p;
+    }
+    __set_PRIMASK(primaskstate);
+    return done;
+}
+#else
+TRICE_INLINE int triceCAS( volatile uint32_t* p, uint32_t* pExpected, uint32_t desired ){
+    uint32_t v = __LDREXW( p );
+    if( v != *pExpected ){
+        __CLREX();
+        *pExpected = v;
+        return 0;
+    }
+    return 0 == __STREXW( desired, p ); // an interrupt between LDREX and STREX lets the store fail
+}
+#endif
+
+//! TRICE_CAS is the compare-and-swap used for the lock-free TRICE_RING_BUFFER_SIZE mode.
+#define TRICE_CAS( p, pExpected, desired ) triceCAS( p, pExpected, desired )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __DMB()
+
 #elif 1 // ####################################################################
 #error "add new compiler here"
 #else // ######################################################################
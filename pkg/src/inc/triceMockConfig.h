@@ -0,0 +1,43 @@
+/*! \file triceMockConfig.h
+\brief common trice configuration of the host tests with the TRICE_WRITE mock in triceWriteMock.c
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_MOCK_CONFIG_H_
+#define TRICE_MOCK_CONFIG_H_
+
+#include <stdint.h>
+
+#define TRICE_MODE 200 //! TRICE_MODE is a predefined trice transfer method.
+
+#define TRICE_ENTER //! TRICE_ENTER is the start of TRICE macro.
+#define TRICE_LEAVE //! TRICE_LEAVE is the end of TRICE macro.
+
+#ifndef TRICE_HALF_BUFFER_SIZE
+#define TRICE_HALF_BUFFER_SIZE 256 //!< This is the size of each of both buffers.
+#endif
+
+#ifndef TRICE_SINGLE_MAX_SIZE
+#define TRICE_SINGLE_MAX_SIZE 64 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+#endif
+
+//! TRICE_WRITE hands the COBS package to the mock in triceWriteMock.c.
+#define TRICE_WRITE( buf, len ) do{ triceWriteMock( buf, len ); }while(0)
+void triceWriteMock( uint8_t const * buf, unsigned len );
+int Written( uint8_t* out );
+
+//! TriceOutDepth returns 0, because triceWriteMock transmits immediately.
+static inline int TriceOutDepth( void ){ return 0; }
+
+#define TRICE_INLINE static inline //! used for trice code
+
+#define ALIGN4                                  //!< align to 4 byte boundary preamble
+#define ALIGN4_END __attribute__ ((aligned(4))) //!< align to 4 byte boundary post declaration
+
+//! TRICE_ENTER_CRITICAL_SECTION saves interrupt state and disables Interrupts.
+#define TRICE_ENTER_CRITICAL_SECTION {
+
+//! TRICE_LEAVE_CRITICAL_SECTION restores interrupt state.
+#define TRICE_LEAVE_CRITICAL_SECTION }
+
+#endif /* TRICE_MOCK_CONFIG_H_ */
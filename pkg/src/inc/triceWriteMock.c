@@ -0,0 +1,32 @@
+/*! \file triceWriteMock.c
+\brief TRICE_WRITE mock of the host tests, included after trice.c
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef TRICE_WRITE_MOCK_SIZE
+#define TRICE_WRITE_MOCK_SIZE (2*TRICE_HALF_BUFFER_SIZE) //!< TRICE_WRITE_MOCK_SIZE is the byte count written holds between two Written calls.
+#endif
+
+static uint8_t written[TRICE_WRITE_MOCK_SIZE]; //!< written holds the bytes written with TRICE_WRITE.
+static unsigned writtenLength = 0; //!< writtenLength is the byte count inside written.
+
+//! triceWriteMock appends buf to written. It aborts the test, when buf does not fit, instead of overwriting memory.
+void triceWriteMock( uint8_t const * buf, unsigned len ){
+    if( len > sizeof(written) - writtenLength ){
+        fprintf( stderr, "triceWriteMock: %u bytes do not fit into the remaining %u bytes, call Written more often or increase TRICE_WRITE_MOCK_SIZE\n", len, (unsigned)(sizeof(written) - writtenLength) );
+        abort();
+    }
+    memcpy( written + writtenLength, buf, len );
+    writtenLength += len;
+}
+
+//! Written copies the bytes written since the last call into out and returns their count.
+int Written( uint8_t* out ){
+    unsigned len = writtenLength;
+    memcpy( out, written, len );
+    writtenLength = 0;
+    return len;
+}
@@ -0,0 +1,17 @@
+/*! \file level.c
+\brief trice.c compiled with TRICE_LEVEL and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "trice.h"
+#include "level.h"
+
+//! TriceLevels writes a trice with value v for several channels into the trice buffer.
+void TriceLevels( int v ){
+    TRICE32_1( Id(1001), "err:error %d\n", v );
+    TRICE32_1( Id(1002), "wrn:warning %d\n", v );
+    TRICE32_1( Id(1003), "inf:info %d\n", v );
+    TRICE32_1( Id(1004), "dbg:debug %d\n", v );
+    TRICE32_1( Id(1005), "no channel %d\n", v );
+}
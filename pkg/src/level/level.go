@@ -0,0 +1,28 @@
+// Package level tests the compile time trice elimination with TRICE_LEVEL and a generated til.h on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package level
+
+// #include <stdint.h>
+// #include "level.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceLevels writes one trice with value v for several channels.
+func triceLevels(v int) {
+	C.TriceLevels(C.int(v))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,10 @@
+/*! \file level.h
+\brief til.h level mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceLevels( int v );
+void TriceTransfer( void );
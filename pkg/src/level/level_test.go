@@ -0,0 +1,15 @@
+package level
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestLevel checks, that with TRICE_LEVEL_WARNING the inf: and dbg: trices are compiled out.
+func TestLevel(t *testing.T) {
+	triceLevels(5)
+	triceTransfer()
+	assert.Equal(t, []int{1001, 1002, 1005}, tricetest.IDs(t, written()))
+}
@@ -0,0 +1,74 @@
+/*! \file til.h
+\brief trice ID metadata generated by "trice update -tilh" from the trice ID list. Do not edit.
+*******************************************************************************/
+
+#ifndef TIL_H_
+#define TIL_H_
+
+#include <stdint.h>
+
+#ifndef TRICE_INLINE
+#define TRICE_INLINE static inline
+#endif
+
+// Channel levels like used by the trice tool -logLevel switch. A bigger value is less important.
+#define TRICE_LEVEL_FATAL 0
+#define TRICE_LEVEL_CRITICAL 1
+#define TRICE_LEVEL_EMERGENCY 2
+#define TRICE_LEVEL_ERROR 3
+#define TRICE_LEVEL_WARNING 4
+#define TRICE_LEVEL_ATT 5
+#define TRICE_LEVEL_INFO 6
+#define TRICE_LEVEL_DEBUG 7
+#define TRICE_LEVEL_TRACE 8
+#define TRICE_LEVEL_TIMESTAMP 9
+#define TRICE_LEVEL_MSG 10
+#define TRICE_LEVEL_READ 11
+#define TRICE_LEVEL_WRITE 12
+#define TRICE_LEVEL_RECEIVE 13
+#define TRICE_LEVEL_TRANSMIT 14
+#define TRICE_LEVEL_DIA 15
+#define TRICE_LEVEL_INT 16
+#define TRICE_LEVEL_SIG 17
+#define TRICE_LEVEL_TST 18
+#define TRICE_LEVEL_DEFAULT 19
+#define TRICE_LEVEL_NOTICE 20
+#define TRICE_LEVEL_ALERT 21
+#define TRICE_LEVEL_ASSERT 22
+#define TRICE_LEVEL_ALARM 23
+#define TRICE_LEVEL_CYCLE 24
+#define TRICE_LEVEL_LOST 25
+#define TRICE_LEVEL_VERBOSE 26
+
+#define TRICE_TIL_MAX_SIZE 8 //!< TRICE_TIL_MAX_SIZE is the biggest head plus parameter size of all trices without dynamic length.
+
+// Channel, level and parameter byte size for each ID. Dynamic length trices have size -1.
+#define TIL_1001_CHANNEL "err"
+#define TIL_1001_LEVEL 3
+#define TIL_1001_SIZE 4
+#define TIL_1002_CHANNEL "wrn"
+#define TIL_1002_LEVEL 4
+#define TIL_1002_SIZE 4
+#define TIL_1003_CHANNEL "inf"
+#define TIL_1003_LEVEL 6
+#define TIL_1003_SIZE 4
+#define TIL_1004_CHANNEL "dbg"
+#define TIL_1004_LEVEL 7
+#define TIL_1004_SIZE 4
+#define TIL_1005_CHANNEL ""
+#define TIL_1005_LEVEL 0
+#define TIL_1005_SIZE 4
+
+//! triceIdLevel returns the channel level of a trice id like Id(58755).
+//! For a constant id the compiler folds it to a constant, so with TRICE_LEVEL the trices above it generate no code.
+TRICE_INLINE int triceIdLevel( uint32_t id ){
+    switch( id >> 16 ){
+        case 1001: return TIL_1001_LEVEL;
+        case 1002: return TIL_1002_LEVEL;
+        case 1003: return TIL_1003_LEVEL;
+        case 1004: return TIL_1004_LEVEL;
+        default: return 0;
+    }
+}
+
+#endif // TIL_H_
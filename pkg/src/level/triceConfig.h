@@ -0,0 +1,23 @@
+/*! \file triceConfig.h
+\brief trice configuration for the til.h level host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_LEVEL TRICE_LEVEL_WARNING //!< Trices with less important channels than wrn: generate no code.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
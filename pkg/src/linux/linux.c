@@ -0,0 +1,40 @@
+/*! \file linux.c
+\brief trice.c compiled for Linux with writer threads for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "linux.h"
+
+static int linuxCount; //!< linuxCount is the trice count of each writer thread.
+
+//! linuxWriter writes linuxCount trices with its thread number and a sequence number.
+static void* linuxWriter( void* arg ){
+    int thread = (int)(intptr_t)arg;
+    for( int i = 0; i < linuxCount; i++ ){
+        TRICE32_2( Id(1001), "msg:%d %d\n", thread, i );
+    }
+    return arg;
+}
+
+//! LinuxOpen calls TriceLinuxOpen and returns 0 or errno.
+int LinuxOpen( char const* path ){
+    return TriceLinuxOpen( path ) ? errno : 0;
+}
+
+//! LinuxClose calls TriceLinuxClose.
+void LinuxClose( void ){
+    TriceLinuxClose();
+}
+
+//! LinuxThreads runs threads writer threads with count trices each concurrently and returns the count of trices dropped until now.
+unsigned LinuxThreads( int threads, int count ){
+    pthread_t t[16];
+    linuxCount = count;
+    for( int i = 0; i < threads; i++ ){
+        pthread_create( &t[i], 0, linuxWriter, (void*)(intptr_t)i );
+    }
+    for( int i = 0; i < threads; i++ ){
+        pthread_join( t[i], 0 );
+    }
+    return TriceRingDropped();
+}
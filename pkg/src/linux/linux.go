@@ -0,0 +1,30 @@
+// Package linux tests the TRICE_LINUX port on the host.
+// The target C-code is compiled with a local triceConfig.h and writes from several threads into a file, a Unix domain socket or a shared memory ring.
+package linux
+
+// #include <stdint.h>
+// #include <stdlib.h>
+// #include "linux.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+// #cgo LDFLAGS: -lpthread -lrt
+import "C"
+import (
+	"unsafe"
+)
+
+// open starts the trice output into path and returns the C errno value.
+func open(path string) int {
+	p := C.CString(path)
+	defer C.free(unsafe.Pointer(p))
+	return int(C.LinuxOpen(p))
+}
+
+// close writes the remaining trices and ends the output.
+func close() {
+	C.LinuxClose()
+}
+
+// threads runs threads writer threads with count trices each and returns the dropped trices count.
+func threads(threads, count int) int {
+	return int(C.LinuxThreads(C.int(threads), C.int(count)))
+}
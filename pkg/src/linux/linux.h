@@ -0,0 +1,10 @@
+/*! \file linux.h
+\brief Linux port interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int LinuxOpen( char const* path );
+void LinuxClose( void );
+unsigned LinuxThreads( int threads, int count );
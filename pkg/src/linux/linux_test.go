@@ -0,0 +1,100 @@
+package linux
+
+import (
+	"encoding/binary"
+	"fmt"
+	"io/ioutil"
+	"net"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/rokath/trice/internal/receiver"
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// decode returns the trices inside the COBS packages in b as thread and sequence number pairs and checks their cycle counters.
+func decode(t *testing.T, b []byte, cycle *uint8) (trices [][2]uint32) {
+	for _, d := range tricetest.Packages(t, b) {
+		assert.Equal(t, []byte{0, 0, 0, 0}, d[:4]) // descriptor
+		for d = d[4:]; len(d) >= 12; d = d[12:] {
+			head := binary.LittleEndian.Uint32(d)
+			assert.Equal(t, uint32(1001<<16|2<<8), head&^0xff)
+			assert.Equal(t, *cycle, uint8(head))
+			*cycle++
+			trices = append(trices, [2]uint32{binary.LittleEndian.Uint32(d[4:]), binary.LittleEndian.Uint32(d[8:])})
+		}
+		assert.Equal(t, 0, len(d))
+	}
+	return
+}
+
+// TestLinuxFile checks that trices from 4 concurrent threads get into the file complete and in the order of each thread.
+func TestLinuxFile(t *testing.T) {
+	dir, err := ioutil.TempDir("", "linux")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	fn := filepath.Join(dir, "trice.bin")
+	assert.Equal(t, 0, open(fn))
+	assert.Equal(t, 0, threads(4, 2000))
+	close()
+	b, err := ioutil.ReadFile(fn)
+	assert.Nil(t, err)
+	cycle := uint8(0xc0)
+	trices := decode(t, b, &cycle)
+	assert.Equal(t, 8000, len(trices))
+	var next [4]uint32
+	for _, tr := range trices {
+		assert.True(t, tr[0] < 4)
+		assert.Equal(t, next[tr[0]], tr[1])
+		next[tr[0]]++
+	}
+}
+
+// TestLinuxSocket checks that the trices wait inside the ring until the trice tool listens on the Unix domain socket.
+func TestLinuxSocket(t *testing.T) {
+	dir, err := ioutil.TempDir("", "linux")
+	assert.Nil(t, err)
+	defer os.RemoveAll(dir)
+	fn := filepath.Join(dir, "trice.sock")
+	assert.Equal(t, 0, open("unix:"+fn))
+	assert.Equal(t, 0, threads(2, 100))
+	ln, err := net.Listen("unix", fn)
+	assert.Nil(t, err)
+	defer ln.Close()
+	received := make(chan []byte)
+	go func() {
+		c, err := ln.Accept()
+		if err != nil {
+			received <- nil
+			return
+		}
+		b, _ := ioutil.ReadAll(c)
+		received <- b
+	}()
+	close()
+	cycle := uint8((0xc0 + 8000) % 256) // continued from TestLinuxFile
+	assert.Equal(t, 200, len(decode(t, <-received, &cycle)))
+}
+
+// TestLinuxShm checks that the trice tool reads the trices from the shared memory ring.
+func TestLinuxShm(t *testing.T) {
+	name := fmt.Sprintf("/trice-test-%d", os.Getpid())
+	defer os.Remove("/dev/shm" + name)
+	assert.Equal(t, 0, open("shm:"+name))
+	assert.Equal(t, 0, threads(3, 1000))
+	close()
+	rc, err := receiver.NewReadWriteCloser(os.Stdout, false, "SHM:"+name, "")
+	assert.Nil(t, err)
+	defer rc.Close()
+	var b []byte
+	buf := make([]byte, 0x100000)         // TRICE_SHM_SIZE
+	for len(b) == 0 || b[len(b)-1] != 0 { // TriceLinuxClose wrote all, so the last Read ends with a package delimiter
+		n, err := rc.Read(buf)
+		assert.Nil(t, err)
+		b = append(b, buf[:n]...)
+	}
+	cycle := uint8((0xc0 + 8200) % 256) // continued from TestLinuxSocket
+	assert.Equal(t, 3000, len(decode(t, b, &cycle)))
+}
@@ -0,0 +1,54 @@
+/*! \file triceConfig.h
+\brief trice configuration for Linux services and the Linux host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_MODE 300 //! TRICE_MODE is a predefined trice transfer method.
+
+//! TRICE_LINUX writes the trices from all threads lock-free into the ring. A flusher thread started with TriceLinuxOpen
+//! encodes them every TRICE_TRANSFER_INTERVAL_MS and writes them into a file, a named pipe or a Unix domain socket.
+#define TRICE_LINUX
+#define TRICE_TRANSFER_INTERVAL_MS 1 //!< TRICE_TRANSFER_INTERVAL_MS is the flusher thread interval.
+//#define TRICE_TIMESTAMP TriceLinuxMicroseconds() //!< Enable for microsecond timestamps.
+
+#define TRICE_RING_BUFFER_SIZE 0x40000 //!< This is the ring size. Must be a power of 2 and able to hold the max trice burst count of all threads within TRICE_TRANSFER_INTERVAL_MS.
+#define TRICE_RING_TRANSFER_SIZE 0x4000 //!< This is the max byte count written with one TriceLinuxWrite.
+#define TRICE_SINGLE_MAX_SIZE 112 //!< TRICE_SINGLE_MAX_SIZE is the stack buffer size for one TRICE.
+
+//! TRICE_ENTER puts each trice into a buffer on the stack of the calling thread.
+#define TRICE_ENTER { uint32_t co[TRICE_SINGLE_MAX_SIZE>>2]; uint32_t* TriceBufferWritePosition = co;
+
+//! TRICE_LEAVE copies the trice from the thread stack buffer into the ring.
+#define TRICE_LEAVE { TriceRingWrite( co, TriceBufferWritePosition - co ); } }
+
+//! TRICE_CAS is the compare-and-swap used for the lock-free TRICE_RING_BUFFER_SIZE mode.
+#define TRICE_CAS( p, pExpected, desired ) __atomic_compare_exchange_n( (p), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __atomic_thread_fence( __ATOMIC_SEQ_CST )
+
+#define TRICE_INLINE static inline //! used for trice code
+
+#define ALIGN4                                  //!< align to 4 byte boundary preamble
+#define ALIGN4_END __attribute__ ((aligned(4))) //!< align to 4 byte boundary post declaration
+
+//! TRICE_ENTER_CRITICAL_SECTION is not needed, because the ring is lock-free.
+#define TRICE_ENTER_CRITICAL_SECTION {
+
+//! TRICE_LEAVE_CRITICAL_SECTION is not needed, because the ring is lock-free.
+#define TRICE_LEAVE_CRITICAL_SECTION }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
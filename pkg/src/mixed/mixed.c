@@ -0,0 +1,8 @@
+/*! \file mixed.c
+\brief trice.c compiled for the C++ TRICE_M with an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "mixed.h"
+
@@ -0,0 +1,16 @@
+/*! \file mixed.cpp
+\brief C++ TRICE_M calls for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "trice.hpp"
+#include "mixed.h"
+
+//! TriceM writes a TRICE_M with 8, 32 and 64 bit integers, floats and a bool.
+void TriceM( int v ){
+    TRICE_M( Id(1501), "msg:%d %u %f %f %t\n", (int8_t)v, (uint32_t)7, 1.5f, 2.5, true );
+}
+
+//! TriceM0 writes a TRICE_M without parameters.
+void TriceM0( void ){
+    TRICE_M( Id(1502), "msg:no parameters\n" );
+}
@@ -0,0 +1,35 @@
+// Package mixed tests the C++ TRICE_M on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+// mixed.cpp writes the trices using trice.hpp.
+package mixed
+
+// #include <stdint.h>
+// #include "mixed.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+// #cgo CXXFLAGS: -g -Wall -std=c++11 -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceMixed writes a TRICE_M with v as 8 bit value and some other types.
+func triceMixed(v int) {
+	C.TriceM(C.int(v))
+}
+
+// triceMixed0 writes a TRICE_M without parameters.
+func triceMixed0() {
+	C.TriceM0()
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
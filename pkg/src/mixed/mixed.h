@@ -0,0 +1,19 @@
+/*! \file mixed.h
+\brief C++ TRICE_M mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int Written( uint8_t* out );
+void TriceM( int v );
+void TriceM0( void );
+void TriceTransfer( void );
+
+#ifdef __cplusplus
+}
+#endif
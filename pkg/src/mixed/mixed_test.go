@@ -0,0 +1,29 @@
+package mixed
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestMixed checks the width descriptor and the parameters packed without padding.
+func TestMixed(t *testing.T) {
+	triceMixed(-2)
+	triceMixed0()
+	triceTransfer()
+	exp := []byte{
+		0, 0, 0, 0, // descriptor
+		0xc0, 6, 0xdd, 0x05, // ID 1501 with 6 payload words
+		0xe8, 0, 0, 5, // 5 parameters: 8, 32, 32, 64 and 8 bit
+		0xfe,       // int8_t -2
+		7, 0, 0, 0, // uint32_t 7
+		0, 0, 0xc0, 0x3f, // float 1.5
+		0, 0, 0, 0, 0, 0, 4, 0x40, // double 2.5
+		1,    // true
+		0, 0, // padding
+		0xc1, 1, 0xde, 0x05, // ID 1502 with the descriptor word only
+		0, 0, 0, 0, // no parameters
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
@@ -0,0 +1,41 @@
+/*! \file overflow.c
+\brief trice.c compiled with buffer overflow protection, flush requests and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "overflow.h"
+
+static int flushRequests = 0; //!< flushRequests counts the TRICE_FLUSH_REQUEST calls.
+
+//! ReadTime returns a fixed timestamp.
+uint32_t ReadTime( void ){
+    return 0x12345678;
+}
+
+//! triceFlushRequestMock counts the flush requests.
+void triceFlushRequestMock( void ){
+    flushRequests++;
+}
+
+//! FlushRequests returns the count of flush requests since the last call.
+int FlushRequests( void ){
+    int n = flushRequests;
+    flushRequests = 0;
+    return n;
+}
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! DroppedTrices returns TriceDroppedTrices().
+unsigned DroppedTrices( void ){
+    return TriceDroppedTrices();
+}
+
+//! DroppedBytes returns TriceDroppedBytes().
+unsigned DroppedBytes( void ){
+    return TriceDroppedBytes();
+}
@@ -0,0 +1,43 @@
+// Package overflow tests the trice buffer overflow protection and the flush requests on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package overflow
+
+// #include <stdint.h>
+// #include "overflow.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// flushRequests returns the count of flush requests since the last call.
+func flushRequests() int {
+	return int(C.FlushRequests())
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// droppedTrices returns the total count of dropped trices.
+func droppedTrices() int {
+	return int(C.DroppedTrices())
+}
+
+// droppedBytes returns the total count of dropped bytes.
+func droppedBytes() int {
+	return int(C.DroppedBytes())
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,13 @@
+/*! \file overflow.h
+\brief buffer overflow protection and flush request mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+int FlushRequests( void );
+void TriceValue( int v );
+unsigned DroppedTrices( void );
+unsigned DroppedBytes( void );
+void TriceTransfer( void );
@@ -0,0 +1,71 @@
+package overflow
+
+import (
+	"encoding/binary"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// record is a decoded trice or control record.
+type record struct {
+	head  uint32
+	value uint32
+}
+
+// decode returns the records inside the COBS packages in b. Each record has a timestamp, a head and one value.
+func decode(t *testing.T, b []byte) (r []record) {
+	for _, d := range tricetest.Packages(t, b) {
+		assert.Equal(t, uint32(1), binary.LittleEndian.Uint32(d)) // COBS package descriptor: timestamp
+		for d = d[4:]; len(d) >= 12; d = d[12:] {
+			assert.Equal(t, uint32(0x12345678), binary.LittleEndian.Uint32(d))
+			r = append(r, record{binary.LittleEndian.Uint32(d[4:]), binary.LittleEndian.Uint32(d[8:])})
+		}
+		assert.Equal(t, 0, len(d))
+	}
+	return
+}
+
+// TestOverflowProtection checks, that trices not fitting into the half buffer are dropped whole and reported.
+func TestOverflowProtection(t *testing.T) {
+	// soft limit: 256 - 104 slack - 12 record = 140, data start at 8, so 11 trices with 12 bytes fit
+	for i := 0; i < 15; i++ {
+		triceValue(i)
+	}
+	assert.Equal(t, 4, droppedTrices())
+	assert.Equal(t, 48, droppedBytes())
+	triceTransfer()
+	r := decode(t, written())
+	assert.Equal(t, 12, len(r))
+	for i := 0; i < 11; i++ {
+		assert.Equal(t, record{58755<<16 | 0x0100 | uint32(0xc0+i), uint32(i)}, r[i])
+	}
+	assert.Equal(t, record{4<<16 | 0xff00 | 1<<2 | 1, 48}, r[11]) // LOST record: 4 trices with 48 bytes
+
+	triceValue(100) // cycle continues without gap
+	triceTransfer()
+	r = decode(t, written())
+	assert.Equal(t, []record{{58755<<16 | 0x0100 | 0xcb, 100}}, r)
+	assert.Equal(t, 4, droppedTrices())
+}
+
+// TestFlushRequest checks, that each trice ending behind the high-water mark requests a transfer.
+func TestFlushRequest(t *testing.T) {
+	written() // discard
+	flushRequests()
+	// high-water mark 64, data start at 8: the 5th trice ends at 68
+	for i := 0; i < 4; i++ {
+		triceValue(i)
+	}
+	assert.Equal(t, 0, flushRequests())
+	triceValue(4)
+	triceValue(5)
+	assert.Equal(t, 2, flushRequests())
+	triceTransfer()
+	assert.Equal(t, 6, len(decode(t, written())))
+	triceValue(6) // new half buffer is below the high-water mark
+	assert.Equal(t, 0, flushRequests())
+	triceTransfer()
+	written()
+}
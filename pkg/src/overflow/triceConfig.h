@@ -0,0 +1,30 @@
+/*! \file triceConfig.h
+\brief trice configuration for the buffer overflow protection and flush request host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_BUFFER_OVERFLOW_PROTECTION //!< Drop trices not fitting into the half buffer and report them with a LOST control record.
+
+#define TRICE_FLUSH_HIGH_WATER 64 //!< Request a transfer, when the write position crosses this half buffer byte offset.
+void triceFlushRequestMock( void );
+#define TRICE_FLUSH_REQUEST() triceFlushRequestMock() //!< triceFlushRequestMock is in overflow.c.
+
+extern uint32_t ReadTime( void );
+#define TRICE_TIMESTAMP ReadTime() //!< ReadTime is mocked in overflow.c.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
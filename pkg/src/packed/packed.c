@@ -0,0 +1,22 @@
+/*! \file packed.c
+\brief trice.c compiled with packed parameters and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "packed.h"
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! TriceBuffer writes len bytes from buf with TRICE_N.
+void TriceBuffer( uint8_t const* buf, unsigned len ){
+    TRICE_N( Id(1001), "msg:%s\n", buf, len );
+}
+
+//! TriceValues writes a single trice with values v and w into the trice buffer.
+void TriceValues( int v, int w ){
+    TRICE32_2( Id(58756), "rd:TRICE32_2 line %d, %d\n", v, w );
+}
@@ -0,0 +1,38 @@
+// Package packed tests the zigzag varint parameter packing on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package packed
+
+// #include <stdint.h>
+// #include "packed.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 2048)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// triceValues writes a single trice with values v and w.
+func triceValues(v, w int) {
+	C.TriceValues(C.int(v), C.int(w))
+}
+
+// triceBuffer writes b with TRICE_N.
+func triceBuffer(b []byte) {
+	C.TriceBuffer((*C.uint8_t)(unsafe.Pointer(&b[0])), C.unsigned(len(b)))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
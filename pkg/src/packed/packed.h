@@ -0,0 +1,12 @@
+/*! \file packed.h
+\brief packed parameter mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceValue( int v );
+void TriceValues( int v, int w );
+void TriceBuffer( uint8_t const* buf, unsigned len );
+void TriceTransfer( void );
@@ -0,0 +1,38 @@
+package packed
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestPackedParams checks the zigzag varints, the unpacked fallback and the padding.
+func TestPackedParams(t *testing.T) {
+	triceValue(7)
+	triceValues(-1, 300)
+	triceValue(0x08000000) // needs 5 varint bytes, so stays unpacked
+	triceValue(-64)
+	triceTransfer()
+	exp := []byte{
+		8, 0, 0, 0, // descriptor: packed parameters
+		0xc0, 0x81, 0x83, 0xe5, 0x0e, // 7
+		0xc1, 0x82, 0x84, 0xe5, 0x01, 0xd8, 0x04, // -1, 300
+		0xc2, 0x01, 0x83, 0xe5, 0x00, 0x00, 0x00, 0x08, // 0x08000000
+		0xc3, 0x81, 0x83, 0xe5, 0x7f, // -64
+		0, 0, 0, // padding
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
+
+// TestPackedLongBuffer checks, that a packable trice with 127 words stays unpacked,
+// because with bit 15 its length byte would be 0xFF, the control record mark.
+func TestPackedLongBuffer(t *testing.T) {
+	triceBuffer(make([]byte, 504))
+	triceTransfer()
+	d := tricetest.Package(t, written())
+	assert.Equal(t, 4+4+4+504, len(d))
+	assert.Equal(t, []byte{8, 0, 0, 0}, d[:4])        // descriptor: packed parameters
+	assert.Equal(t, []byte{0x7f, 0xe9, 0x03}, d[5:8]) // 127 words unpacked, ID 1001
+	assert.Equal(t, []byte{0xf8, 1, 0, 0}, d[8:12])   // length 504
+}
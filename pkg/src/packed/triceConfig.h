@@ -0,0 +1,26 @@
+/*! \file triceConfig.h
+\brief trice configuration for the packed parameter host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_PACKED_PARAMS //!< Zigzag varint parameters, when shorter.
+
+#define TRICE_HALF_BUFFER_SIZE 1024 //!< This is the size of each of both buffers.
+#define TRICE_SINGLE_MAX_SIZE 512 //!< The max size with TRICE_PACKED_PARAMS.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
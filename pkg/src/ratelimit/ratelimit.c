@@ -0,0 +1,37 @@
+/*! \file ratelimit.c
+\brief trice.c compiled with the trice rate limit and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "ratelimit.h"
+
+uint32_t RateClock = 0; //!< RateClock is the TRICE_SPAN_CLOCK() value.
+static int flushRequests = 0; //!< flushRequests counts the TRICE_FLUSH_REQUEST calls.
+
+//! SetClock sets RateClock.
+void SetClock( uint32_t clock ){
+    RateClock = clock;
+}
+
+//! triceFlushRequestMock counts the flush requests.
+void triceFlushRequestMock( void ){
+    flushRequests++;
+}
+
+//! FlushRequests returns the count of flush requests since the last call.
+int FlushRequests( void ){
+    int n = flushRequests;
+    flushRequests = 0;
+    return n;
+}
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! TriceValues writes a single trice with values v and w into the trice buffer.
+void TriceValues( int v, int w ){
+    TRICE32_2( Id(58756), "rd:TRICE32_2 line %d, %d\n", v, w );
+}
@@ -0,0 +1,43 @@
+// Package ratelimit tests the target side trice rate limit on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package ratelimit
+
+// #include <stdint.h>
+// #include "ratelimit.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// triceValues writes a single trice with values v and w.
+func triceValues(v, w int) {
+	C.TriceValues(C.int(v), C.int(w))
+}
+
+// setClock sets the TRICE_SPAN_CLOCK value.
+func setClock(clock uint32) {
+	C.SetClock(C.uint32_t(clock))
+}
+
+// flushRequests returns the count of flush requests since the last call.
+func flushRequests() int {
+	return int(C.FlushRequests())
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,13 @@
+/*! \file ratelimit.h
+\brief trice rate limit mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void SetClock( uint32_t clock );
+int FlushRequests( void );
+void TriceValue( int v );
+void TriceValues( int v, int w );
+void TriceTransfer( void );
@@ -0,0 +1,73 @@
+package ratelimit
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// records returns the trice IDs and control records inside the only COBS package in b.
+func records(t *testing.T, b []byte) (r []string) {
+	d := tricetest.Package(t, b)
+	if len(d) < 4 {
+		return
+	}
+	for d = d[4:]; len(d) >= 4; { // skip descriptor
+		if d[1] == 0xff { // control record
+			r = append(r, fmt.Sprint("type ", d[0]>>2, " value ", int(d[3])<<8|int(d[2]), " payload ", int(d[5])<<8|int(d[4])))
+			d = d[4+4*int(d[0]&3):]
+			continue
+		}
+		r = append(r, fmt.Sprint(int(d[3])<<8|int(d[2])))
+		d = d[4+4*int(d[1]):]
+	}
+	return
+}
+
+// TestRateLimit checks, that a flooding trice ID is limited without affecting other IDs and the suppressed count is reported.
+func TestRateLimit(t *testing.T) {
+	for i := 0; i < 10; i++ {
+		triceValue(i)
+	}
+	triceValues(1, 2)
+	triceTransfer()
+	assert.Equal(t, []string{"58755", "58755", "58755", "58756"}, records(t, written()))
+	triceValue(10) // a transfer refills no tokens
+	triceTransfer()
+	assert.Equal(t, []string(nil), records(t, written()))
+	setClock(100) // tokens refilled after the period
+	triceValue(11)
+	triceValues(3, 4)
+	triceTransfer()
+	assert.Equal(t, []string{"type 2 value 8 payload 58755", "58755", "58756"}, records(t, written()))
+	setClock(250)
+	triceValue(12)
+	triceTransfer()
+	assert.Equal(t, []string{"58755"}, records(t, written()))
+}
+
+// TestRateLimitFlush checks, that the transfers requested by a flooding trice ID over the high-water mark do not lift its limit.
+func TestRateLimitFlush(t *testing.T) {
+	setClock(1000)
+	flushRequests() // clear the requests of the previous test
+	var r []string
+	var flushes int
+	for i := 0; i < 20; i++ {
+		triceValue(i)
+		if flushRequests() > 0 { // the app transfers on request
+			flushes++
+			triceTransfer()
+			r = append(r, records(t, written())...)
+		}
+	}
+	triceTransfer()
+	r = append(r, records(t, written())...)
+	assert.Equal(t, 1, flushes)
+	assert.Equal(t, []string{"58755", "58755", "58755"}, r)
+	setClock(1100)
+	triceValue(20)
+	triceTransfer()
+	assert.Equal(t, []string{"type 2 value 17 payload 58755", "58755"}, records(t, written()))
+}
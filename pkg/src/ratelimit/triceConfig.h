@@ -0,0 +1,31 @@
+/*! \file triceConfig.h
+\brief trice configuration for the trice rate limit host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_RATE_LIMIT_SLOTS 16 //!< Token bucket count for hashed trice IDs.
+#define TRICE_RATE_LIMIT_BURST 3 //!< Max trices per ID and period.
+#define TRICE_RATE_LIMIT_PERIOD 100 //!< The tokens are refilled every 100 clock ticks.
+#define TRICE_SPAN_CLOCK() RateClock //!< RateClock is set by the host tests.
+extern uint32_t RateClock;
+
+#define TRICE_FLUSH_HIGH_WATER 24 //!< Request a transfer with the third trice of a package.
+void triceFlushRequestMock( void );
+#define TRICE_FLUSH_REQUEST() triceFlushRequestMock() //!< triceFlushRequestMock is in ratelimit.c.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
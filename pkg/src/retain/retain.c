@@ -0,0 +1,23 @@
+/*! \file retain.c
+\brief trice.c compiled with the the trice buffer in no-init RAM and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "retain.h"
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! TriceValues writes a single trice with values v and w into the trice buffer.
+void TriceValues( int v, int w ){
+    TRICE32_2( Id(58756), "rd:TRICE32_2 line %d, %d\n", v, w );
+}
+
+//! Reset simulates a target reset. Only the variables outside the no-init section get their start values.
+void Reset( void ){
+    TriceCycle = 0xc0;
+    TriceInit();
+}
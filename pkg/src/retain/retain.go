@@ -0,0 +1,33 @@
+// Package retain tests the trice buffer retention in no-init RAM over a target reset on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package retain
+
+// #include <stdint.h>
+// #include "retain.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
+
+// reset simulates a target reset and calls TriceInit.
+func reset() {
+	C.Reset()
+}
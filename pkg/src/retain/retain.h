@@ -0,0 +1,12 @@
+/*! \file retain.h
+\brief trice no-init RAM retention mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceValue( int v );
+void TriceValues( int v, int w );
+void TriceTransfer( void );
+void Reset( void );
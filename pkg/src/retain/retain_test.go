@@ -0,0 +1,54 @@
+package retain
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// values returns the COBS package descriptor and the first parameter of each trice inside the only COBS package in b.
+func values(t *testing.T, b []byte) (descriptor int, r []int) {
+	d := tricetest.Package(t, b)
+	if len(d) < 4 {
+		return
+	}
+	descriptor = int(d[0])
+	for d = d[4:]; len(d) >= 8; {
+		r = append(r, int(d[4]))
+		d = d[4+4*int(d[1]):]
+	}
+	return
+}
+
+// TestRetain checks, that trices not transmitted before a reset are sent first after it in a marked package.
+func TestRetain(t *testing.T) {
+	reset() // power on: no valid buffer state
+	triceValue(1)
+	triceTransfer()
+	desc, v := values(t, written())
+	assert.Equal(t, 0, desc)
+	assert.Equal(t, []int{1}, v)
+
+	triceTransfer() // transmission done
+	triceValue(2)
+	triceValue(3)
+	reset() // 2 and 3 are not transmitted yet
+	triceValue(4)
+	triceTransfer()
+	desc, v = values(t, written())
+	assert.Equal(t, 16, desc)
+	assert.Equal(t, []int{2, 3}, v)
+
+	triceTransfer()
+	desc, v = values(t, written())
+	assert.Equal(t, 0, desc)
+	assert.Equal(t, []int{4}, v)
+
+	triceValue(5)
+	triceTransfer() // 5 is in transmission
+	assert.NotNil(t, written())
+	reset() // the slot in transmission is not sent again
+	triceTransfer()
+	assert.Equal(t, 0, len(written()))
+}
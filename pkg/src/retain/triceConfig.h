@@ -0,0 +1,23 @@
+/*! \file triceConfig.h
+\brief trice configuration for the trice no-init RAM retention host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_NOINIT __attribute__((section(".noinit"))) //!< The trice buffer state survives resets.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,18 @@
+/*! \file spans.c
+\brief trice.c compiled with a span clock mock and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "spans.h"
+
+uint32_t SpanClock = 0; //!< SpanClock is the TRICE_SPAN_CLOCK() value.
+
+//! TriceSpan writes a span from clock value begin to end with a trice inside.
+void TriceSpan( uint32_t begin, uint32_t end ){
+    SpanClock = begin;
+    TRICE_SPAN_BEGIN( Id(1601), "adc" );
+    TRICE8_1( Id(1603), "msg:%d\n", 5 );
+    SpanClock = end;
+    TRICE_SPAN_END( Id(1602), "adc" );
+}
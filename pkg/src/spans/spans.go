@@ -0,0 +1,28 @@
+// Package spans tests the span profiling macros on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package spans
+
+// #include <stdint.h>
+// #include "spans.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceSpan writes a span from clock value begin to end.
+func triceSpan(begin, end uint32) {
+	C.TriceSpan(C.uint32_t(begin), C.uint32_t(end))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,10 @@
+/*! \file spans.h
+\brief span profiling mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceSpan( uint32_t begin, uint32_t end );
+void TriceTransfer( void );
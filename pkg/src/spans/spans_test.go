@@ -0,0 +1,37 @@
+package spans
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// TestSpans checks the span control records around a trice. They do not use the cycle counter.
+func TestSpans(t *testing.T) {
+	triceSpan(100, 0x12345678)
+	triceTransfer()
+	exp := []byte{
+		0, 0, 0, 0, // descriptor
+		0x0d, 0xff, 0x41, 0x06, 100, 0, 0, 0, // span begin of ID 1601
+		0xc0, 1, 0x43, 0x06, 5, 0, 0, 0, // trice
+		0x11, 0xff, 0x42, 0x06, 0x78, 0x56, 0x34, 0x12, // span end of ID 1602
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
+
+// TestSpansRateLimit checks, that the rate limit suppresses the trice inside the second span but not the span records.
+func TestSpansRateLimit(t *testing.T) {
+	triceSpan(1, 2)
+	triceSpan(3, 4)
+	triceTransfer()
+	exp := []byte{
+		0, 0, 0, 0, // descriptor
+		0x0d, 0xff, 0x41, 0x06, 1, 0, 0, 0, // span begin of ID 1601
+		0xc1, 1, 0x43, 0x06, 5, 0, 0, 0, // trice
+		0x11, 0xff, 0x42, 0x06, 2, 0, 0, 0, // span end of ID 1602
+		0x0d, 0xff, 0x41, 0x06, 3, 0, 0, 0, // span begin of ID 1601
+		0x11, 0xff, 0x42, 0x06, 4, 0, 0, 0, // span end of ID 1602
+	}
+	assert.Equal(t, exp, tricetest.Package(t, written()))
+}
@@ -0,0 +1,26 @@
+/*! \file triceConfig.h
+\brief trice configuration for the span profiling host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_SPAN_CLOCK() SpanClock //!< SpanClock is set by the host tests.
+#define TRICE_RATE_LIMIT_SLOTS 16 //!< Token bucket count for hashed trice IDs. The span records must not be limited.
+#define TRICE_RATE_LIMIT_BURST 1 //!< Max trices per ID between two TriceTransfer calls.
+extern uint32_t SpanClock;
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,100 @@
+/*! \file tcobs.c
+\brief TCOBS encoder
+\details TCOBS is a COBS variant with run length compression. Each encoded frame ends with a sigil byte.
+A sigil byte carries in its lower bits the count of literal bytes between it and the previous sigil (offset).
+A decoder starts at the frame end and follows the offsets backwards.
+For details see docs/TCOBSSpecification.md.
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "tcobs.h"
+
+#define N  0xA0 //!< sigil byte 101ooooo, no operation, offset 0-31
+#define Z1 0x20 //!< sigil byte 001ooooo, 1 zero, offset 0-31
+#define Z2 0x40 //!< sigil byte 010ooooo, 2 zeroes, offset 0-31
+#define Z3 0x60 //!< sigil byte 011ooooo, 3 zeroes, offset 0-31
+#define F2 0xC0 //!< sigil byte 110ooooo, 2 0xFF, offset 0-31
+#define F3 0xE0 //!< sigil byte 111ooooo, 3 0xFF, offset 0-31
+#define F4 0x80 //!< sigil byte 100ooooo, 4 0xFF, offset 0-31
+#define R2 0x08 //!< sigil byte 00001ooo, repeat last byte 2 times, offset 0-7
+#define R3 0x10 //!< sigil byte 00010ooo, repeat last byte 3 times, offset 0-7
+#define R4 0x18 //!< sigil byte 00011ooo, repeat last byte 4 times, offset 0-7
+
+//! zSigil and fSigil map a run length to the appropriate sigil.
+static const uint8_t zSigil[] = { 0, Z1, Z2, Z3 };
+static const uint8_t fSigil[] = { 0, 0, F2, F3, F4 };
+static const uint8_t rSigil[] = { 0, 0, R2, R3, R4 };
+
+//! TCOBSEncode stuffs "length" bytes of data at the location pointed to by "input"
+//! and writes the output to the location pointed to by "output".
+//! Returns the number of bytes written to "output".
+int TCOBSEncode( void * restrict output, const void * restrict input, size_t length){
+    uint8_t* o = output;
+    const uint8_t* i = input;
+    const uint8_t* limit = i + length;
+    unsigned offset = 0; // literal bytes count since last sigil
+    while( i < limit ){
+        uint8_t b = *i++;
+        unsigned n = 0; // same bytes following b
+        while( i + n < limit && i[n] == b ){
+            n++;
+        }
+        if( b == 0 ){ // zero runs are always sigils
+            n++;
+            i--;
+            while( n ){
+                unsigned k = n < 3 ? n : 3;
+                *o++ = zSigil[k] | offset;
+                offset = 0;
+                i += k;
+                n -= k;
+            }
+            continue;
+        }
+        if( b == 0xFF && n ){ // 0xFF runs with 2 or more bytes are sigils
+            n++;
+            i--;
+            while( n > 1 ){
+                unsigned k = n < 4 ? n : 4;
+                *o++ = fSigil[k] | offset;
+                offset = 0;
+                i += k;
+                n -= k;
+            }
+            if( n == 0 ){
+                continue;
+            }
+            i++; // a single 0xFF remains as literal
+            n = 0;
+        }
+        *o++ = b; // literal
+        offset++;
+        if( offset == 31 ){
+            *o++ = N | offset;
+            offset = 0;
+        }
+        while( n > 1 ){ // b repetitions as sigils
+            unsigned k = n < 4 ? n : 4;
+            if( offset > 7 ){ // R sigils have only 3 offset bits
+                *o++ = N | offset;
+                offset = 0;
+            }
+            *o++ = rSigil[k] | offset;
+            offset = 0;
+            i += k;
+            n -= k;
+        }
+        if( n == 1 ){ // a single repetition stays literal
+            i++;
+            *o++ = b;
+            offset++;
+            if( offset == 31 ){
+                *o++ = N | offset;
+                offset = 0;
+            }
+        }
+    }
+    if( offset ){ // a frame ends always with a sigil
+        *o++ = N | offset;
+    }
+    return o - (uint8_t*)output;
+}
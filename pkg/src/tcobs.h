@@ -0,0 +1,27 @@
+/*! \file tcobs.h
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TCOBS_H_
+#define TCOBS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+//! TCOBSEncode stuffs "length" bytes of data at the location pointed to by "input"
+//! and writes the output to the location pointed to by "output".
+//! Returns the number of bytes written to "output". No 0-delimiter is added.
+//! The output contains no 0 and is at most length + length/31 + 1 bytes long.
+//! Runs of 0x00 and 0xFF and repeated bytes are compressed.
+//! Output and input can overlap, if "output" is enough bytes in front of "input".
+int TCOBSEncode( void * restrict output, const void * restrict input, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TCOBS_H_
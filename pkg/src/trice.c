@@ -1,6 +1,7 @@
 /*! \file trice.c
 \author Thomas.Hoehenleitner [at] seerose.net
 *******************************************************************************/
+#define TRICE_IMPLEMENTATION //!< TRICE_IMPLEMENTATION keeps the inline TRICE macros for trice.c also with TRICE_FUNCTIONS.
 #include "trice.h"
 #define TRICE_FILE Id(56030)
 
@@ -10,51 +11,453 @@ char triceCommand[TRICE_COMMAND_SIZE_MAX+1]; // with terminating 0
 //! triceCommandFlag ist set, when a command was received completely.
 int triceCommandFlag = 0; // updated
 
+#ifdef TRICE_ID_BITMAP_BITS
+//! triceIdDisabled has a set bit for each disabled trice ID. After reset all IDs are enabled.
+//! IDs with equal lower bits share one bit, when TRICE_ID_BITMAP_BITS is smaller than 65536.
+uint32_t triceIdDisabled[TRICE_ID_BITMAP_BITS>>5] = {0};
+
+//! TriceIdCommand executes the trice ID commands "@-id" and "@+id" from the trice tool.
+//! "@-" and "@+" without id disable or enable all trices.
+//! \param cmd is a 0-terminated command string, usually triceCommand.
+//! \retval 1, if cmd was an ID command, otherwise 0.
+int TriceIdCommand( char const* cmd ){
+    unsigned id = 0;
+    char const* p = cmd + 2;
+    if( cmd[0] != '@' || (cmd[1] != '-' && cmd[1] != '+') ){
+        return 0;
+    }
+    if( *p == 0 ){ // all IDs
+        memset( triceIdDisabled, cmd[1] == '-' ? 0xff : 0, sizeof(triceIdDisabled) );
+        return 1;
+    }
+    for( ; *p; p++ ){
+        if( *p < '0' || '9' < *p ){
+            return 0;
+        }
+        id = 10*id + (*p - '0');
+    }
+    id &= TRICE_ID_BITMAP_BITS-1;
+    if( cmd[1] == '-' ){
+        triceIdDisabled[id>>5] |= 1u << (id & 31);
+    }else{
+        triceIdDisabled[id>>5] &= ~(1u << (id & 31));
+    }
+    return 1;
+}
+#endif // #ifdef TRICE_ID_BITMAP_BITS
+
 static unsigned triceDepthMax = 0; //!< triceDepthMax is a diagnostics value usable to optimize buffer size.
 
 #if TRICE_CYCLE_COUNTER == 1
 uint8_t  TriceCycle = 0xc0; //!< TriceCycle is increased and transmitted with each trice message, if enabled.
 #endif
 
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) // buffered out to UART
+static int triceNonBlockingWrite( void const * buf, int nByte );
+#define TRICE_WRITE( buf, len ) do{ triceNonBlockingWrite( buf, len ); }while(0)
+#endif
+
 #ifdef TRICE_HALF_BUFFER_SIZE
-static uint32_t triceBuffer[2][TRICE_HALF_BUFFER_SIZE>>2] = {0}; //!< triceBuffer is a double buffer for better write speed.
-static int triceSwap = 0; //!< triceSwap is the index of the active write buffer. !triceSwap is the active read buffer index.
+#ifdef TRICE_NOINIT
+#define TRICE_RETAINED TRICE_NOINIT //!< TRICE_RETAINED places the buffer state into the no-init section. TriceInit initializes it.
+#else
+#define TRICE_RETAINED //!< TRICE_RETAINED is empty, so the buffer state is zeroed at startup.
+#endif
+
+TRICE_RETAINED static uint32_t triceBuffer[TRICE_BUFFER_SLOTS][TRICE_HALF_BUFFER_SIZE>>2]; //!< triceBuffer is a queue of buffer slots. One slot is written, the others are queued for output or free.
+TRICE_RETAINED static int triceSwap; //!< triceSwap is the index of the active write buffer slot.
+TRICE_RETAINED static int triceRead; //!< triceRead is the index of the oldest queued buffer slot.
+TRICE_RETAINED static int triceQueued; //!< triceQueued is the count of closed buffer slots not transmitted completely yet.
+TRICE_RETAINED static int triceSending; //!< triceSending is 1 while the buffer slot triceRead is transmitted.
+#ifdef TRICE_NOINIT
+TRICE_RETAINED uint32_t* TriceBufferWritePosition; //!< TriceBufferWritePosition is the active write position.
+#else
     uint32_t* TriceBufferWritePosition = &triceBuffer[0][TRICE_DATA_OFFSET>>2]; //!< TriceBufferWritePosition is the active write position.
-static uint32_t* triceBufferWriteLimit = &triceBuffer[1][TRICE_DATA_OFFSET>>2]; //!< triceBufferWriteLimit is the triceBuffer written limit. 
+#endif
+TRICE_RETAINED static uint32_t* triceBufferWriteLimit[TRICE_BUFFER_SLOTS]; //!< triceBufferWriteLimit holds the written limit of each closed buffer slot.
 
-#if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE ) // buffered out to UART
-static int triceNonBlockingWrite( void const * buf, int nByte );
-#define TRICE_WRITE( buf, len ) do{ triceNonBlockingWrite( buf, len ); }while(0)
+#if defined(TRICE_NOINIT) || defined(TRICE_URGENT_BUFFER_SIZE)
+static uint32_t triceOutFlags = 0; //!< triceOutFlags are the TRICE_COBS_PRE_RESET_FLAG and TRICE_COBS_URGENT_FLAG for the package in TriceOut.
+#endif
+
+#ifdef TRICE_FLUSH_HIGH_WATER
+uint32_t* TriceFlushLimit = &triceBuffer[0][TRICE_FLUSH_HIGH_WATER>>2]; //!< TriceFlushLimit is the write position, behind which each TRICE macro calls TRICE_FLUSH_REQUEST.
+#endif
+
+#if defined(TRICE_NOINIT) || defined(TRICE_ZERO_COPY)
+//! triceInside returns 1, if p points into buffer slot between the trice data start and the slot end.
+static int triceInside( uint32_t const* p, int slot ){
+    return &triceBuffer[slot][TRICE_DATA_OFFSET>>2] <= p && p <= &triceBuffer[slot][TRICE_HALF_BUFFER_SIZE>>2];
+}
+#endif
+
+#ifdef TRICE_ZERO_COPY
+int TriceByReference = 0; //!< TriceByReference is 1 inside TRICE_BY_REFERENCE.
+static int triceReferences[TRICE_BUFFER_SLOTS]; //!< triceReferences is the count of buffer references in each buffer slot.
+static uint32_t* triceReferenceAt[TRICE_BUFFER_SLOTS][TRICE_ZERO_COPY_REFERENCES]; //!< triceReferenceAt is the slot position, where the referenced buffer belongs.
+static uint8_t const* triceReferenceBuf[TRICE_BUFFER_SLOTS][TRICE_ZERO_COPY_REFERENCES]; //!< triceReferenceBuf is the referenced buffer.
+static uint32_t triceReferenceLen[TRICE_BUFFER_SLOTS][TRICE_ZERO_COPY_REFERENCES]; //!< triceReferenceLen is the referenced buffer byte count.
+static void triceOutReferences( int slot );
+
+//! TriceReference records buf at the write position instead of copying it. It is called by TRICE_PUTBUFFER inside TRICE_BY_REFERENCE.
+//! \retval 1 when buf is referenced
+//! \retval 0 when buf needs to be copied, because all references of the slot are used or an urgent trice is written
+int TriceReference( void const* buf, uint32_t len ){
+    int n = triceReferences[triceSwap];
+    if( n == TRICE_ZERO_COPY_REFERENCES || !triceInside( TriceBufferWritePosition, triceSwap ) ){
+        return 0;
+    }
+    triceReferenceAt[triceSwap][n] = TriceBufferWritePosition;
+    triceReferenceBuf[triceSwap][n] = buf;
+    triceReferenceLen[triceSwap][n] = len;
+    triceReferences[triceSwap] = n + 1;
+    return 1;
+}
+
+//! TriceReferenced returns 1 as long as a not transmitted trice references a part of buf.
+//! The app must not change buf until then.
+int TriceReferenced( void const* buf, uint32_t len ){
+    uint8_t const* p = buf;
+    for( int slot = 0; slot < TRICE_BUFFER_SLOTS; slot++ ){
+        for( int i = 0; i < triceReferences[slot]; i++ ){
+            if( triceReferenceBuf[slot][i] < p + len && p < triceReferenceBuf[slot][i] + triceReferenceLen[slot][i] ){
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+#endif // #ifdef TRICE_ZERO_COPY
+
+#ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+uint32_t* TriceBufferSoftLimit = &triceBuffer[0][TRICE_BUFFER_SOFT_LIMIT>>2]; //!< TriceBufferSoftLimit is the write position limit. Trices ending behind it are dropped.
+static unsigned triceDroppedTrices = 0; //!< triceDroppedTrices is the total count of dropped trices.
+static unsigned triceDroppedBytes = 0; //!< triceDroppedBytes is the total count of dropped trice bytes.
+static unsigned triceLostTrices = 0; //!< triceLostTrices is the count of dropped trices not reported to the host yet.
+static unsigned triceLostBytes = 0; //!< triceLostBytes is the count of dropped trice bytes not reported to the host yet.
+
+//! TriceBufferDrop removes the trice written from start on and counts it.
+//! It is called inside the TRICE macros, when the trice ends behind TriceBufferSoftLimit.
+//! The trice cycle counter is set back too, so the host sees only the LOST control record.
+void TriceBufferDrop( uint32_t* start ){
+    unsigned size = (TriceBufferWritePosition - start)<<2;
+    TriceBufferWritePosition = start;
+    triceDroppedTrices++;
+    triceDroppedBytes += size;
+    triceLostTrices++;
+    triceLostBytes += size;
+    #if TRICE_CYCLE_COUNTER == 1
+    TriceCycle--;
+    #endif
+    #ifdef TRICE_ZERO_COPY
+    if( triceInside( start, triceSwap ) ){ // forget the references of the dropped trice
+        while( triceReferences[triceSwap] && triceReferenceAt[triceSwap][triceReferences[triceSwap]-1] > start ){
+            triceReferences[triceSwap]--;
+        }
+    }
+    #endif
+}
+
+//! TriceDroppedTrices returns the total count of trices dropped because of a full buffer.
+unsigned TriceDroppedTrices( void ){
+    return triceDroppedTrices;
+}
+
+//! TriceDroppedBytes returns the total count of bytes dropped because of a full buffer.
+unsigned TriceDroppedBytes( void ){
+    return triceDroppedBytes;
+}
+
+//! tricePutLostRecord appends a LOST control record to the active write buffer, when trices were dropped.
+//! The space behind the soft limit is big enough for it.
+static void tricePutLostRecord( void ){
+    if( triceLostTrices ){
+        unsigned count = triceLostTrices < 0xffff ? triceLostTrices : 0xffff;
+        TRICE_PUT_PREFIX
+        TRICE_PUT( TRICE_CONTROL_HEAD( TRICE_CONTROL_LOST, count, 1 ) );
+        TRICE_PUT( triceLostBytes );
+        triceLostTrices = 0;
+        triceLostBytes = 0;
+    }
+}
+#endif // #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+
+#ifdef TRICE_RATE_LIMIT_SLOTS
+static uint8_t triceRateCount[TRICE_RATE_LIMIT_SLOTS]; //!< triceRateCount is the trice count of each slot since the last refill.
+static uint16_t triceSuppressed[TRICE_RATE_LIMIT_SLOTS]; //!< triceSuppressed is the suppressed trice count of each slot not reported to the host yet.
+#ifdef TRICE_RATE_LIMIT_PERIOD
+static uint32_t triceRateRefill; //!< triceRateRefill is the TRICE_SPAN_CLOCK() value of the last token bucket refill.
+#endif
+
+//! TriceRateCheck is a token bucket per hashed trice ID, refilled with TRICE_RATE_LIMIT_BURST tokens on each TriceTransfer call.
+//! With TRICE_RATE_LIMIT_PERIOD the refill happens instead every TRICE_RATE_LIMIT_PERIOD TRICE_SPAN_CLOCK() ticks,
+//! so transfers requested by a flooding ID with TRICE_FLUSH_HIGH_WATER do not lift its limit.
+//! It is called inside the TRICE macros within the critical section. IDs sharing a slot share the tokens.
+//! The first allowed trice of a slot after a suppression gets a SUPPRESSED control record in front.
+//! \param id is the trice id like Id(58755).
+//! \retval 1 when the trice is allowed
+//! \retval 0 when the trice is suppressed
+int TriceRateCheck( uint32_t id ){
+    unsigned slot = ((id >> 16) ^ (id >> 24)) & (TRICE_RATE_LIMIT_SLOTS-1);
+    #ifdef TRICE_RATE_LIMIT_PERIOD
+    uint32_t now = TRICE_SPAN_CLOCK();
+    if( now - triceRateRefill >= TRICE_RATE_LIMIT_PERIOD ){ // the clock can wrap
+        triceRateRefill = now;
+        memset( triceRateCount, 0, sizeof(triceRateCount) ); // refill all token buckets
+    }
+    #endif
+    if( triceRateCount[slot] >= TRICE_RATE_LIMIT_BURST ){
+        if( triceSuppressed[slot] < 0xffff ){
+            triceSuppressed[slot]++;
+        }
+        return 0;
+    }
+    triceRateCount[slot]++;
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    if( TriceBufferWritePosition + ((TRICE_PREFIX_SIZE + 8)>>2) > TriceBufferSoftLimit ){
+        return 1; // report later, the space behind the soft limit is for the LOST record
+    }
+    #endif
+    if( triceSuppressed[slot] ){
+        TRICE_PUT_PREFIX
+        TRICE_PUT( TRICE_CONTROL_HEAD( TRICE_CONTROL_SUPPRESSED, triceSuppressed[slot], 1 ) );
+        TRICE_PUT( id >> 16 );
+        triceSuppressed[slot] = 0;
+    }
+    return 1;
+}
+#endif // #ifdef TRICE_RATE_LIMIT_SLOTS
+
+//! triceWriteSlot sets the write position and the limits to the start of buffer slot for the next TRICE.
+static void triceWriteSlot( int slot ){
+    TriceBufferWritePosition = &triceBuffer[slot][TRICE_DATA_OFFSET>>2];
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    TriceBufferSoftLimit = &triceBuffer[slot][TRICE_BUFFER_SOFT_LIMIT>>2];
+    #endif
+    #ifdef TRICE_FLUSH_HIGH_WATER
+    TriceFlushLimit = &triceBuffer[slot][TRICE_FLUSH_HIGH_WATER>>2];
+    #endif
+}
+
+#ifdef TRICE_NOINIT
+#define TRICE_RETAIN_MAGIC 0x7E1CE5AFu //!< TRICE_RETAIN_MAGIC marks a valid buffer state in the no-init section.
+TRICE_RETAINED static uint32_t triceRetainMagic; //!< triceRetainMagic is TRICE_RETAIN_MAGIC, when TriceInit initialized the buffer state.
+static int triceRetainedSlots = 0; //!< triceRetainedSlots is the count of queued slots written before the last reset.
+
+//! triceRetainedValid checks the buffer state found in the no-init section after a reset.
+static int triceRetainedValid( void ){
+    if( triceRetainMagic != TRICE_RETAIN_MAGIC
+     || triceSwap < 0 || triceSwap >= TRICE_BUFFER_SLOTS
+     || triceRead < 0 || triceRead >= TRICE_BUFFER_SLOTS
+     || triceQueued < 0 || triceQueued >= TRICE_BUFFER_SLOTS
+     || (triceRead + triceQueued) % TRICE_BUFFER_SLOTS != triceSwap
+     || !triceInside( TriceBufferWritePosition, triceSwap ) ){
+        return 0;
+    }
+    for( int i = 0; i < triceQueued; i++ ){
+        int slot = (triceRead + i) % TRICE_BUFFER_SLOTS;
+        if( !triceInside( triceBufferWriteLimit[slot], slot ) ){
+            return 0;
+        }
+    }
+    return 1;
+}
+
+//! triceDropOldest frees the oldest queued buffer slot.
+static void triceDropOldest( void ){
+    triceRead = (triceRead + 1) % TRICE_BUFFER_SLOTS;
+    triceQueued--;
+}
+
+//! TriceInit must be called after each reset before the first TRICE.
+//! It checks the buffer state in the no-init section TRICE_NOINIT. If the trices written before the reset survived,
+//! they are queued and the next TriceTransfer calls send them first as packages with TRICE_COBS_PRE_RESET_FLAG.
+//! Otherwise it clears the buffer state.
+void TriceInit( void ){
+    if( triceRetainedValid() ){
+        if( triceSending ){ // TriceOut encodes in place, so the slot in transmission cannot be sent again
+            triceDropOldest();
+        }
+        if( TriceBufferWritePosition != &triceBuffer[triceSwap][TRICE_DATA_OFFSET>>2] ){ // close the active slot
+            if( triceQueued == TRICE_BUFFER_SLOTS - 1 ){ // keep a free slot for the new trices
+                triceDropOldest();
+            }
+            triceBufferWriteLimit[triceSwap] = TriceBufferWritePosition;
+            triceSwap = (triceSwap + 1) % TRICE_BUFFER_SLOTS;
+            triceQueued++;
+        }
+    }else{
+        triceSwap = 0;
+        triceRead = 0;
+        triceQueued = 0;
+    }
+    triceRetainedSlots = triceQueued;
+    triceSending = 0;
+    triceWriteSlot( triceSwap );
+    triceRetainMagic = TRICE_RETAIN_MAGIC;
+}
+#endif // #ifdef TRICE_NOINIT
+
+#ifdef TRICE_URGENT_BUFFER_SIZE
+#ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+#define TRICE_URGENT_SOFT_LIMIT (TRICE_URGENT_BUFFER_SIZE - TRICE_BUFFER_SLACK - TRICE_LOST_RECORD_SIZE) //!< TRICE_URGENT_SOFT_LIMIT is the byte offset inside an urgent buffer, where trices get dropped.
+#if TRICE_URGENT_SOFT_LIMIT <= TRICE_DATA_OFFSET
+#error "TRICE_URGENT_BUFFER_SIZE is too small for TRICE_BUFFER_OVERFLOW_PROTECTION."
+#endif
+#endif
+
+static uint32_t triceUrgent[2][TRICE_URGENT_BUFFER_SIZE>>2]; //!< triceUrgent is a double buffer for urgent trices. One is written, the other is transmitted.
+static int triceUrgentSwap = 0; //!< triceUrgentSwap is the index of the urgent write buffer.
+static uint32_t* triceUrgentWritePosition = &triceUrgent[0][TRICE_DATA_OFFSET>>2]; //!< triceUrgentWritePosition is the urgent write position outside TriceUrgentEnter and TriceUrgentLeave.
+static int triceUrgentNesting = 0; //!< triceUrgentNesting counts the TriceUrgentEnter calls without TriceUrgentLeave.
+static uint32_t* triceBulkWritePosition; //!< triceBulkWritePosition is the saved write position of the buffer slots.
+#ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+static uint32_t* triceBulkSoftLimit; //!< triceBulkSoftLimit is the saved soft limit of the buffer slots.
 #endif
+#ifdef TRICE_FLUSH_HIGH_WATER
+static uint32_t* triceBulkFlushLimit; //!< triceBulkFlushLimit is the saved flush limit of the buffer slots.
+#endif
+#if TRICE_CYCLE_COUNTER == 1
+static uint8_t triceBulkCycle; //!< triceBulkCycle is the saved cycle counter. Urgent trices do not advance it, so the buffer slots have no cycle gaps.
+#endif
+
+//! TriceUrgentEnter lets the following TRICE macros write into the urgent buffer.
+//! It must be called inside the critical section and can be nested.
+void TriceUrgentEnter( void ){
+    if( triceUrgentNesting++ ){
+        return;
+    }
+    triceBulkWritePosition = TriceBufferWritePosition;
+    TriceBufferWritePosition = triceUrgentWritePosition;
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    triceBulkSoftLimit = TriceBufferSoftLimit;
+    TriceBufferSoftLimit = &triceUrgent[triceUrgentSwap][TRICE_URGENT_SOFT_LIMIT>>2];
+    #endif
+    #ifdef TRICE_FLUSH_HIGH_WATER
+    triceBulkFlushLimit = TriceFlushLimit;
+    TriceFlushLimit = &triceUrgent[triceUrgentSwap][TRICE_URGENT_BUFFER_SIZE>>2]; // TriceUrgentLeave requests the transfer
+    #endif
+    #if TRICE_CYCLE_COUNTER == 1
+    triceBulkCycle = TriceCycle;
+    #endif
+}
+
+//! TriceUrgentLeave switches the TRICE macros back to the buffer slots and requests a transfer with TRICE_FLUSH_REQUEST, if it exists.
+void TriceUrgentLeave( void ){
+    if( --triceUrgentNesting ){
+        return;
+    }
+    triceUrgentWritePosition = TriceBufferWritePosition;
+    TriceBufferWritePosition = triceBulkWritePosition;
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    TriceBufferSoftLimit = triceBulkSoftLimit;
+    #endif
+    #ifdef TRICE_FLUSH_HIGH_WATER
+    TriceFlushLimit = triceBulkFlushLimit;
+    #endif
+    #if TRICE_CYCLE_COUNTER == 1
+    TriceCycle = triceBulkCycle;
+    #endif
+    #ifdef TRICE_FLUSH_REQUEST
+    TRICE_FLUSH_REQUEST();
+    #endif
+}
+
+//! triceUrgentTransfer closes the urgent write buffer, if it contains trices, and hands it to TriceOut.
+//! The output must be free.
+//! \retval 1 when an urgent package is transmitted
+//! \retval 0 when the urgent buffer is empty
+static int triceUrgentTransfer( void ){
+    int slot = triceUrgentSwap;
+    uint32_t* limit;
+    TRICE_ENTER_CRITICAL_SECTION
+    limit = triceUrgentWritePosition;
+    if( limit != &triceUrgent[slot][TRICE_DATA_OFFSET>>2] ){
+        triceUrgentSwap = !slot;
+        triceUrgentWritePosition = &triceUrgent[!slot][TRICE_DATA_OFFSET>>2];
+    }
+    TRICE_LEAVE_CRITICAL_SECTION
+    if( slot == triceUrgentSwap ){
+        return 0;
+    }
+    triceOutFlags = TRICE_COBS_URGENT_FLAG;
+    TriceOut( &triceUrgent[slot][0], ((limit - &triceUrgent[slot][0])<<2) - TRICE_DATA_OFFSET );
+    return 1;
+}
+#endif // #ifdef TRICE_URGENT_BUFFER_SIZE
 
-//! triceBufferSwap swaps the trice double buffer and returns the read buffer address.
-static uint32_t* triceBufferSwap( void ){
+//! triceBufferSwap closes the active write buffer slot, if it contains trices, and continues writing into the next slot.
+//! The next slot must be free.
+//! \retval 1 when the slot was closed and queued for output
+//! \retval 0 when the slot is empty
+static int triceBufferSwap( void ){
+    int closed = 0;
     TRICE_ENTER_CRITICAL_SECTION
-    triceBufferWriteLimit = TriceBufferWritePosition; // keep end position
-    triceSwap = !triceSwap; // exchange the 2 buffers
-    TriceBufferWritePosition = &triceBuffer[triceSwap][TRICE_DATA_OFFSET>>2]; // set write position for next TRICE
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    tricePutLostRecord();
+    #endif
+    #if defined(TRICE_RATE_LIMIT_SLOTS) && !defined(TRICE_RATE_LIMIT_PERIOD)
+    memset( triceRateCount, 0, sizeof(triceRateCount) ); // refill all token buckets
+    #endif
+    if( TriceBufferWritePosition != &triceBuffer[triceSwap][TRICE_DATA_OFFSET>>2] ){
+        closed = 1;
+        triceBufferWriteLimit[triceSwap] = TriceBufferWritePosition; // keep end position
+        triceSwap = (triceSwap + 1) % TRICE_BUFFER_SLOTS; // use next slot
+        triceWriteSlot( triceSwap );
+    }
     TRICE_LEAVE_CRITICAL_SECTION
-    return &triceBuffer[!triceSwap][0];
+    return closed;
 }
 
-//! triceDepth returns the total trice byte count ready for transfer.
-//! The trice data start at tb + TRICE_DATA_OFFSET.
+//! triceDepth returns the total trice byte count ready for transfer in buffer slot.
+//! The trice data start at TRICE_DATA_OFFSET.
 //! The returned depth is without the TRICE_DATA_OFFSET offset.
-static size_t triceDepth( uint32_t* tb ){
-    size_t depth = (triceBufferWriteLimit - tb)<<2; // 32-bit write width
+static size_t triceDepth( int slot ){
+    size_t depth = (triceBufferWriteLimit[slot] - &triceBuffer[slot][0])<<2; // 32-bit write width
     return depth - TRICE_DATA_OFFSET;
 }
 
-//! TriceTransfer, if possible, swaps the double buffer and initiates a write.
+//! TriceTransfer frees the transmitted buffer slot, closes the write slot, if a free slot exists, and initiates a write of the oldest queued slot.
+//! With TRICE_BUFFER_SLOTS 2 this is the classic double buffer swap. More slots let the TRICE macros continue in a new slot while earlier slots are in flight.
 //! It is the resposibility of the app to call this function once every 10-100 milliseconds.
+//! With TRICE_FLUSH_HIGH_WATER the app calls it additionally on TRICE_FLUSH_REQUEST and the cyclic call is only a timeout for quiet periods.
+//! With TRICE_URGENT_BUFFER_SIZE the urgent buffer is transmitted first, whenever the output is free.
 void TriceTransfer( void ){
-    if( 0 == TriceOutDepth() ){ // transmission done, so a swap is possible
-        uint32_t* tb = triceBufferSwap(); 
-        size_t tLen = triceDepth(tb); // tlen is always a multiple of 4
-        if( tLen ){
-            TriceOut( tb, tLen );
+    if( triceSending && 0 == TriceOutDepth() ){ // transmission done, so the slot is free again
+        triceSending = 0;
+        #ifdef TRICE_ZERO_COPY
+        triceReferences[triceRead] = 0; // the referenced buffers are free again
+        #endif
+        triceRead = (triceRead + 1) % TRICE_BUFFER_SLOTS;
+        triceQueued--;
+    }
+    if( triceQueued < TRICE_BUFFER_SLOTS - 1 ){ // the next slot is free
+        triceQueued += triceBufferSwap();
+    }
+    #ifdef TRICE_URGENT_BUFFER_SIZE
+    if( triceSending || 0 != TriceOutDepth() || triceUrgentTransfer() ){
+        return; // output busy, also with urgent trices, which go first
+    }
+    #endif
+    if( !triceSending && triceQueued ){ // transmission done and s.th. to send
+        triceSending = 1;
+        #if defined(TRICE_NOINIT) || defined(TRICE_URGENT_BUFFER_SIZE)
+        triceOutFlags = 0;
+        #endif
+        #ifdef TRICE_NOINIT
+        if( triceRetainedSlots ){ // the oldest slots were written before the last reset
+            triceRetainedSlots--;
+            triceOutFlags = TRICE_COBS_PRE_RESET_FLAG;
+        }
+        #endif
+        #ifdef TRICE_ZERO_COPY
+        if( triceReferences[triceRead] ){
+            triceOutReferences( triceRead );
+            return;
         }
-    } // else: transmission not done yet
+        #endif
+        TriceOut( &triceBuffer[triceRead][0], triceDepth(triceRead) ); // depth is always a multiple of 4
+    }
 }
 
 //! TriceDepthMax returns the max trice buffer depth until now.
@@ -62,14 +465,306 @@ size_t TriceDepthMax( void ){
     size_t currentDepth = 4*(TriceBufferWritePosition - &triceBuffer[triceSwap][0]); 
     return currentDepth > triceDepthMax ? currentDepth : triceDepthMax;
 }
-#else // #ifdef TRICE_HALF_BUFFER_SIZE
+
+#ifdef TRICE_FRAGMENTS
+//! triceFragmentRoom returns the byte count a trice can still use in the active write buffer slot.
+static size_t triceFragmentRoom( void ){
+    #ifdef TRICE_BUFFER_OVERFLOW_PROTECTION
+    uint32_t const* limit = TriceBufferSoftLimit;
+    #else
+    uint32_t const* limit = &triceBuffer[triceSwap][TRICE_HALF_BUFFER_SIZE>>2];
+    #endif
+    return TriceBufferWritePosition < limit ? (limit - TriceBufferWritePosition)<<2 : 0;
+}
+#endif
+#endif // #ifdef TRICE_HALF_BUFFER_SIZE
+
+#ifdef TRICE_RING_BUFFER_SIZE
+#ifndef TRICE_CAS
+#error "TRICE_RING_BUFFER_SIZE needs TRICE_CAS and TRICE_MEMORY_BARRIER in the triceConfig.h compiler adaption."
+#endif
+
+#define TRICE_RING_WORDS (TRICE_RING_BUFFER_SIZE>>2) //!< TRICE_RING_WORDS is the ring size in 32-bit words.
+#define TRICE_RING_MASK (TRICE_RING_WORDS-1) //!< TRICE_RING_MASK maps a free running word index into the ring.
+#define TRICE_RING_INDEX_MASK 0x00FFFFFFu //!< TRICE_RING_INDEX_MASK limits the free running word indices to 24 bits.
+
+//! triceRing holds the trice records, one ring for each core. Each record is a header word followed by the trice data words.
+//! The header word is the record data word count. It stays 0 until the producer commits the record.
+//! The consumer clears each record it read, so an uncommitted header position is always 0.
+static uint32_t triceRing[TRICE_RING_CORES][TRICE_RING_WORDS] = {{0}};
+
+//! triceRingState is the reservation state of each ring: the free running 24-bit write word index in the upper 3 bytes
+//! and the count of used cycle values in the lowest byte. The next cycle is 0xC0 plus that count. It is changed only with TRICE_CAS.
+static volatile uint32_t triceRingState[TRICE_RING_CORES] = {0};
+
+//! triceRingRead is the free running 24-bit read word index of each ring. It is changed only by TriceTransfer.
+static volatile uint32_t triceRingRead[TRICE_RING_CORES] = {0};
+
+//! triceRingDropped counts the trices not fitting into the ring. Their cycle values are skipped, so the trice tool detects the loss.
+static volatile uint32_t triceRingDropped = 0;
+
+//! triceRingOut is the output buffer TriceTransfer copies the committed records into. The ring itself is never encoded in place.
+static uint32_t triceRingOut[(TRICE_DATA_OFFSET + TRICE_RING_TRANSFER_SIZE)>>2];
+
+//! triceRingCore is the ring TriceTransfer moves next. With TRICE_RING_CORES > 1 it is the core tag in the COBS package descriptor.
+static unsigned triceRingCore = 0;
+
+static unsigned triceRingDepthMax = 0; //!< triceRingDepthMax is the max ring usage in bytes, seen during reservation.
+
+//! TriceRingWrite copies count words from buf as one record into the ring of the TRICE_CORE_ID() core.
+//! It is lock-free and can be called concurrently from thread and interrupt context, also from other cores.
+//! The space is reserved with a compare-and-swap on triceRingState, then filled and committed with the header word.
+//! If the ring has not enough space, the trice is dropped and counted.
+//! \param buf is the trice data start, optional prefix followed by the trice head.
+//! \param count is the trice data word count.
+void TriceRingWrite( uint32_t const* buf, unsigned count ){
+    unsigned core = TRICE_CORE_ID(); // a thread moved to an other core meanwhile writes into a ring shared with it, what is fine
+    uint32_t* ring = triceRing[core];
+    uint32_t state = triceRingState[core];
+    uint32_t next, wr, used;
+    int fits;
+    int control = (buf[TRICE_PREFIX_SIZE>>2] & 0xff00) == 0xff00; // control records have no cycle counter
+    do{
+        wr = state >> 8;
+        used = (wr - triceRingRead[core]) & TRICE_RING_INDEX_MASK;
+        fits = used + count + 1 <= TRICE_RING_WORDS;
+        next = fits ? (((wr + count + 1) & TRICE_RING_INDEX_MASK) << 8) : (state & ~0xffu);
+        next |= (state + !control) & 0xff; // a dropped trice consumes its cycle value too
+    }while( !TRICE_CAS( &triceRingState[core], &state, next ) );
+    if( !fits ){
+        uint32_t dropped = triceRingDropped;
+        while( !TRICE_CAS( &triceRingDropped, &dropped, dropped + 1 ) );
+        return;
+    }
+    used = (used + count + 1) << 2;
+    triceRingDepthMax = used < triceRingDepthMax ? triceRingDepthMax : used; // diagnostics
+    for( unsigned i = 0; i < count; i++ ){
+        ring[(wr + 1 + i) & TRICE_RING_MASK] = buf[i];
+    }
+    #if TRICE_CYCLE_COUNTER == 1
+    if( !control ){ // TRICE_CYCLE is 0 in the trice head, so insert the reserved cycle here.
+        uint32_t* head = &ring[(wr + 1 + (TRICE_PREFIX_SIZE>>2)) & TRICE_RING_MASK];
+        *head |= (state + 0xc0) & 0xff;
+    }
+    #endif
+    TRICE_MEMORY_BARRIER(); // data must be visible before the commit
+    *(volatile uint32_t*)&ring[wr & TRICE_RING_MASK] = count; // commit
+}
+
+//! TriceRingDropped returns the count of trices dropped because of a full ring.
+unsigned TriceRingDropped( void ){
+    return triceRingDropped;
+}
+
+//! triceRingTransfer moves the committed records of the triceRingCore ring into the output buffer and initiates a write.
+//! It stops at the first not yet committed record, so records still written by an interrupted producer stay in the ring.
+static void triceRingTransfer( void ){
+    uint32_t* ring = triceRing[triceRingCore];
+    uint32_t* tb = triceRingOut;
+    uint32_t* da = tb + (TRICE_DATA_OFFSET>>2);
+    uint32_t rd = triceRingRead[triceRingCore];
+    size_t tLen = 0;
+    for(;;){
+        uint32_t count = *(volatile uint32_t*)&ring[rd & TRICE_RING_MASK];
+        if( 0 == count || tLen + (count<<2) > TRICE_RING_TRANSFER_SIZE ){
+            break; // not committed yet or no space left in output buffer
+        }
+        TRICE_MEMORY_BARRIER(); // read data only after the commit
+        ring[rd & TRICE_RING_MASK] = 0;
+        for( unsigned i = 1; i <= count; i++ ){
+            uint32_t* p = &ring[(rd + i) & TRICE_RING_MASK];
+            *da++ = *p;
+            *p = 0; // a later record header could be here
+        }
+        tLen += count<<2;
+        rd = (rd + count + 1) & TRICE_RING_INDEX_MASK;
+        TRICE_MEMORY_BARRIER(); // ring cleared before the space is released
+        triceRingRead[triceRingCore] = rd;
+    }
+    if( tLen ){
+        TriceOut( tb, tLen );
+    }
+}
+
+//! TriceTransfer, if possible, moves the committed records from the rings into the output buffer and initiates a write for each ring.
+//! It goes round robin over the rings, as long as the output is free, so a busy core cannot starve the others.
+//! It is the resposibility of the app to call this function once every 10-100 milliseconds, but not concurrently.
+void TriceTransfer( void ){
+    for( unsigned i = 0; i < TRICE_RING_CORES && 0 == TriceOutDepth(); i++ ){ // else: transmission not done yet
+        triceRingTransfer();
+        triceRingCore = (triceRingCore + 1) % TRICE_RING_CORES;
+    }
+}
+
+//! TriceDepthMax returns the max trice ring depth until now.
+size_t TriceDepthMax( void ){
+    return triceRingDepthMax;
+}
+#endif // #ifdef TRICE_RING_BUFFER_SIZE
+
+#ifndef TRICE_DEFERRED_OUT
 
 //! TriceDepthMax returns the max trice buffer depth until now.
 size_t TriceDepthMax( void ){
     return triceDepthMax;
 }
 
-#endif // #else #ifdef TRICE_HALF_BUFFER_SIZE
+#endif // #ifndef TRICE_DEFERRED_OUT
+
+#ifdef TRICE_FRAGMENTS
+static uint8_t triceTransferId = 0; //!< triceTransferId numbers the fragmented transfers.
+
+//! TriceFragments streams len bytes from buf as a sequence of fragments. Each fragment is a TRICE_N with id and up to TRICE_FRAGMENT_SIZE bytes.
+//! The length word has bit 31 set, bit 30 marks the last fragment, bits 23..16 are the transfer id and bits 15..0 the fragment byte count.
+//! The following word is the fragment byte offset inside buf. The trice tool reassembles the fragments.
+//! With TRICE_HALF_BUFFER_SIZE it calls TRICE_FRAGMENT_WAIT until the next fragment fits into the write buffer slot,
+//! so call it only from the context doing the TriceTransfer calls or define TRICE_FRAGMENT_WAIT accordingly.
+//! \param id is the trice id like Id(58755).
+//! \param buf is the buffer to transmit.
+//! \param len is the buffer byte count.
+void TriceFragments( uint32_t id, void const* buf, uint32_t len ){
+    uint8_t const* p = buf;
+    uint32_t offset = 0;
+    uint32_t transfer;
+    TRICE_ENTER_CRITICAL_SECTION
+    transfer = triceTransferId++;
+    TRICE_LEAVE_CRITICAL_SECTION
+    do{
+        uint32_t count = len - offset < TRICE_FRAGMENT_SIZE ? len - offset : TRICE_FRAGMENT_SIZE;
+        uint32_t last = offset + count == len ? 0x40000000 : 0;
+        #ifdef TRICE_HALF_BUFFER_SIZE
+        while( triceFragmentRoom() < TRICE_PREFIX_SIZE + 12 + count ){
+            TRICE_FRAGMENT_WAIT();
+        }
+        #endif
+        TRICE_INTO( id )
+        TRICE_PUT( id | (0xff00 & ((count+11)<<6)) | TRICE_CYCLE ); // +3 for padding, +8 for the length and offset words
+        TRICE_PUT( 0x80000000 | last | (transfer<<16) | count );
+        TRICE_PUT( offset );
+        TRICE_PUTBUFFER( p + offset, count );
+        TRICE_OUTOF
+        offset += count;
+    }while( offset < len );
+}
+#endif // #ifdef TRICE_FRAGMENTS
+
+#ifdef TRICE_PACKED_PARAMS
+//! triceZigzag maps small positive and negative values to small unsigned values.
+static inline uint32_t triceZigzag( uint32_t v ){
+    return (v << 1) ^ (uint32_t)((int32_t)v >> 31);
+}
+
+//! triceVarintSize returns the byte count of the zigzag varints for count words at p.
+//! If a word needs 5 bytes, the result is 4*count+1, so no packing happens then.
+static size_t triceVarintSize( uint32_t const* p, size_t count ){
+    size_t size = 0;
+    for( size_t i = 0; i < count; i++ ){
+        uint32_t z = triceZigzag( p[i] );
+        if( z >= 1u<<28 ){
+            return 4*count+1;
+        }
+        size += z < 1u<<7 ? 1 : z < 1u<<14 ? 2 : z < 1u<<21 ? 3 : 4;
+    }
+    return size;
+}
+
+//! triceVarintPack writes count words from rd as zigzag varints to wr and returns the new write position.
+//! Each word takes at most 4 bytes here, so wr can be rd.
+static uint8_t* triceVarintPack( uint8_t* wr, uint32_t const* rd, size_t count ){
+    for( size_t i = 0; i < count; i++ ){
+        uint32_t z = triceZigzag( rd[i] );
+        while( z >= 0x80 ){
+            *wr++ = (uint8_t)(z | 0x80);
+            z >>= 7;
+        }
+        *wr++ = (uint8_t)z;
+    }
+    return wr;
+}
+#endif // #ifdef TRICE_PACKED_PARAMS
+
+#if defined(TRICE_DELTA_TIMESTAMP) || defined(TRICE_PACKED_PARAMS)
+//! triceCompact shortens the trices in buf during transfer.
+//! With TRICE_DELTA_TIMESTAMP the 32-bit timestamp of each trice is replaced by its delta to the previous trice.
+//! A delta below 0x8000 takes 2 bytes, any other one 4 bytes as signed 31-bit value with bit 15 set in the first 16-bit unit.
+//! So a timestamp can step backwards, like in TRICE_MODE 300, where the timestamp is read before the ring space is reserved.
+//! Trices inside one package must be less than 2^30 timestamp ticks apart.
+//! With TRICE_PACKED_PARAMS the parameter words of a trice are replaced by zigzag varints, when that is shorter.
+//! Bit 15 in the head marks such a trice. Its length byte still counts the unpacked words.
+//! So trices with 124 or more words stay unpacked, because with bit 15 their length byte would be in the reserved range 0xFC to 0xFF.
+//! The trices get never longer, so the compaction is done in place. The result is zero padded to a multiple of 4.
+//! \param buf is the start of the trice data inside one package.
+//! \param len is the trice data length, always a multiple of 4.
+//! \param first gets the timestamp of the first trice as absolute package timestamp.
+//! \retval is the compacted length.
+static size_t triceCompact( uint32_t* buf, size_t len, uint32_t* first ){
+    uint32_t const* rd = buf;
+    uint32_t const* end = buf + (len>>2);
+    uint8_t* wr = (uint8_t*)buf;
+    #ifdef TRICE_DELTA_TIMESTAMP
+    uint32_t last = buf[(TRICE_PREFIX_SIZE>>2)-1]; // timestamp is the last prefix word
+    *first = last;
+    #endif
+    while( rd < end ){
+        uint32_t head;
+        size_t n; // payload bytes
+        #ifdef TRICE_DELTA_TIMESTAMP
+        #ifdef TRICE_LOCATION
+        uint32_t loc = *rd++;
+        #endif
+        uint32_t ts = *rd++;
+        uint32_t delta = ts - last;
+        head = *rd++; // read all before writing, because wr can reach into them
+        last = ts;
+        #ifdef TRICE_LOCATION
+        memcpy( wr, &loc, 4 );
+        wr += 4;
+        #endif
+        if( delta < 0x8000 ){
+            uint16_t d = delta;
+            memcpy( wr, &d, 2 );
+            wr += 2;
+        }else{ // signed 31 bits are enough inside one package, the receiver takes bit 30 as sign
+            uint16_t d[2] = { 0x8000 | (uint16_t)((delta >> 16) & 0x7fff), (uint16_t)delta };
+            memcpy( wr, d, 4 );
+            wr += 4;
+        }
+        #else
+        memmove( wr, rd, TRICE_PREFIX_SIZE );
+        wr += TRICE_PREFIX_SIZE;
+        rd += TRICE_PREFIX_SIZE>>2;
+        head = *rd++;
+        #endif
+        n = (head & 0xff00) == 0xff00 ? (head & 3)<<2 : (head >> 6) & 0x3fc;
+        #ifdef TRICE_PACKED_PARAMS
+        if( (head & 0xff00) < 0x7c00 && triceVarintSize( rd, n>>2 ) < n ){ // with bit 15 a length byte from 0x7C on would be reserved or a control record
+            head |= 0x8000;
+            memcpy( wr, &head, 4 );
+            wr = triceVarintPack( wr + 4, rd, n>>2 );
+            rd += n>>2;
+            continue;
+        }
+        #endif
+        memcpy( wr, &head, 4 );
+        wr += 4;
+        memmove( wr, rd, n );
+        wr += n;
+        rd += n>>2;
+    }
+    while( (wr - (uint8_t*)buf) & 3 ){
+        *wr++ = 0;
+    }
+    return wr - (uint8_t*)buf;
+}
+#endif // #if defined(TRICE_DELTA_TIMESTAMP) || defined(TRICE_PACKED_PARAMS)
+
+#if defined(TRICE_NOINIT) || defined(TRICE_URGENT_BUFFER_SIZE)
+#define TRICE_COBS_DESCRIPTOR (TRICE_COBS_PACKAGE_MODE|triceOutFlags) //!< TRICE_COBS_DESCRIPTOR marks retained and urgent packages.
+#elif defined(TRICE_RING_BUFFER_SIZE) && TRICE_RING_CORES > 1
+#define TRICE_COBS_DESCRIPTOR (TRICE_COBS_PACKAGE_MODE|TRICE_COBS_CORE_FLAG|triceRingCore<<8) //!< TRICE_COBS_DESCRIPTOR carries the core tag.
+#else
+#define TRICE_COBS_DESCRIPTOR TRICE_COBS_PACKAGE_MODE //!< TRICE_COBS_DESCRIPTOR is the first word of each COBS package.
+#endif
 
 //! TriceOut converts trice data and transmits them to the output.
 //! \param tb is start of uint32_t* trice buffer. The space TRICE_DATA_OFFSET>>2
@@ -80,13 +775,24 @@ void TriceOut( uint32_t* tb, size_t tLen ){
     size_t eLen, cLen;
     uint8_t* co = (uint8_t*)tb; // encoded COBS data starting address
     uint32_t* da = tb + (TRICE_DATA_OFFSET>>2)-1; // start of unencoded COBS package data: descriptor and trice data
-    *da = TRICE_COBS_PACKAGE_MODE; // add a 32-bit COBS package mode descriptor in front of trice data. That allowes to inject third-party non-trice COBS packages.
+    *da = TRICE_COBS_DESCRIPTOR; // add a 32-bit COBS package mode descriptor in front of trice data. That allowes to inject third-party non-trice COBS packages.
     eLen = tLen + 4; // add COBS package mode descriptor length 
-    #ifdef TRICE_ENCRYPT
+    #ifdef TRICE_DELTA_TIMESTAMP
+    da -= 1; // space for the absolute package timestamp
+    da[0] = TRICE_COBS_DESCRIPTOR;
+    eLen = 8 + triceCompact( da + 2, tLen, da + 1 );
+    #elif defined(TRICE_PACKED_PARAMS)
+    eLen = 4 + triceCompact( da + 1, tLen, 0 );
+    #endif
+    #if defined(TRICE_ENCRYPT_CTR)
+    da -= 2; // space for keystream counter and nonce
+    TriceEncryptCTR( da, eLen>>2 ); // no padding needed
+    eLen += 8;
+    #elif defined(TRICE_ENCRYPT)
     eLen = (eLen + 4) & ~7; // only multiple of 8 encryptable
     TriceEncrypt( da, eLen>>2 );
     #endif
-    cLen = TriceCOBSEncode(co, (uint8_t*)da, eLen);
+    cLen = TRICE_COBS_ENCODE(co, (uint8_t*)da, eLen);
     do{                 // Add 1 to 4 zeroes as COBS package delimiter.
         co[cLen++] = 0; // One is ok, but padding to an uint32_t border could make TRICE_WRITE faster.
     }while( cLen & 3 ); // Additional empty packages are ignored on th receiver side.
@@ -95,7 +801,58 @@ void TriceOut( uint32_t* tb, size_t tLen ){
     triceDepthMax = tLen < triceDepthMax ? triceDepthMax : tLen; // diagnostics
 }
 
-#if defined( TRICE_UART ) && !defined( TRICE_HALF_BUFFER_SIZE ) // direct out to UART
+#ifdef TRICE_ZERO_COPY
+static uint8_t triceCobsBlock[255]; //!< triceCobsBlock is the COBS code byte and up to 254 data bytes of the block in work.
+static unsigned triceCobsCount; //!< triceCobsCount is the byte count inside triceCobsBlock.
+static unsigned triceCobsTotal; //!< triceCobsTotal is the written COBS byte count of the package in work.
+
+//! triceCobsWriteBlock writes the COBS block in work to the output and starts the next one.
+static void triceCobsWriteBlock( void ){
+    triceCobsBlock[0] = triceCobsCount;
+    TRICE_WRITE( triceCobsBlock, triceCobsCount );
+    triceCobsTotal += triceCobsCount;
+    triceCobsCount = 1;
+}
+
+//! triceCobsPut COBS encodes len bytes from p block by block into the output. The result is identical to TriceCOBSEncode.
+static void triceCobsPut( uint8_t const* p, size_t len ){
+    while( len-- ){
+        uint8_t c = *p++;
+        if( c ){
+            triceCobsBlock[triceCobsCount++] = c;
+        }
+        if( !c || triceCobsCount == 255 ){
+            triceCobsWriteBlock();
+        }
+    }
+}
+
+//! triceOutReferences transmits buffer slot with the referenced buffers inserted.
+//! It COBS encodes straight from the slot and the referenced buffers, so TRICE_WRITE is called for each COBS block.
+static void triceOutReferences( int slot ){
+    static uint8_t const zeroes[4] = {0};
+    uint32_t descriptor = TRICE_COBS_DESCRIPTOR;
+    uint8_t const* p = (uint8_t const*)&triceBuffer[slot][TRICE_DATA_OFFSET>>2];
+    size_t depth = triceDepth( slot ) + TRICE_DATA_OFFSET;
+    triceCobsCount = 1;
+    triceCobsTotal = 0;
+    triceCobsPut( (uint8_t const*)&descriptor, 4 );
+    for( int i = 0; i < triceReferences[slot]; i++ ){
+        uint8_t const* at = (uint8_t const*)triceReferenceAt[slot][i];
+        uint32_t len = triceReferenceLen[slot][i];
+        triceCobsPut( p, at - p );
+        triceCobsPut( triceReferenceBuf[slot][i], len );
+        triceCobsPut( zeroes, -len & 3 ); // padding like TRICE_PUTBUFFER
+        p = at;
+    }
+    triceCobsPut( p, (uint8_t const*)triceBufferWriteLimit[slot] - p );
+    triceCobsWriteBlock();
+    TRICE_WRITE( zeroes, 4 - (triceCobsTotal & 3) ); // 1 to 4 zeroes as COBS package delimiter like in TriceOut
+    triceDepthMax = depth < triceDepthMax ? triceDepthMax : depth; // diagnostics
+}
+#endif // #ifdef TRICE_ZERO_COPY
+
+#if defined( TRICE_UART ) && !defined( TRICE_DEFERRED_OUT ) // direct out to UART
 //! triceBlockingPutChar returns after c was successfully written.
 static void triceBlockingPutChar( uint8_t c ){
     while( !triceTxDataRegisterEmpty() );
@@ -107,9 +864,33 @@ void TriceBlockingWrite( uint8_t const * buf, unsigned len ){
     for( unsigned i = 0; i < len; i++ ){ 
         triceBlockingPutChar( buf[i] ); }
 }
-#endif // #if defined( TRICE_UART ) && !defined( TRICE_HALF_BUFFER_SIZE )
+#endif // #if defined( TRICE_UART ) && !defined( TRICE_DEFERRED_OUT )
+
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && defined( TRICE_UART_DMA ) // buffered out to UART with DMA
+static volatile int triceDmaCount = 0; //!< triceDmaCount is the byte count of the running DMA transfer and 0 when the DMA is idle.
+
+//! triceNonBlockingWrite hands the whole buffer to the DMA in one shot.
+//! buf must stay valid until TriceDmaTransmitComplete was called, what is given because TriceTransfer waits for TriceOutDepth() == 0.
+static int triceNonBlockingWrite( void const * buf, int nByte ){
+    triceDmaCount = nByte;
+    triceStartDmaTransmit( buf, nByte );
+    return nByte;
+}
 
-#if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE ) // buffered out to UART
+//! TriceOutDepth returns the amount of bytes not written yet.
+//! As long as the DMA transfer is running, this is the whole transfer size.
+int TriceOutDepth( void ){
+    return triceDmaCount;
+}
+
+//! TriceDmaTransmitComplete must be called from the DMA transfer complete interrupt.
+//! Afterwards TriceTransfer can start the next transfer.
+void TriceDmaTransmitComplete( void ){
+    triceDmaCount = 0;
+}
+#endif // #if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && defined( TRICE_UART_DMA )
+
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && !defined( TRICE_UART_DMA ) // buffered out to UART
 static uint8_t const * triceOutBuffer;
 static int triceOutCount = 0;
 static int triceOutIndex = 0;
@@ -147,7 +928,216 @@ void triceTriggerTransmit(void){
         triceEnableTxEmptyInterrupt(); // next bytes
     }
 }
-#endif // #if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE )
+#endif // #if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && !defined( TRICE_UART_DMA )
+
+#ifdef TRICE_LINUX
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static int triceLinuxFd = -1; //!< triceLinuxFd is the output file descriptor and -1 while there is no output.
+static int triceLinuxSocket = 0; //!< triceLinuxSocket is !0 for a Unix domain socket output, which gets reconnected.
+static struct sockaddr_un triceLinuxAddress; //!< triceLinuxAddress is the Unix domain socket path.
+static volatile int triceLinuxRunning = 0; //!< triceLinuxRunning is !0 as long as the flusher thread should run.
+static pthread_t triceLinuxFlusher; //!< triceLinuxFlusher is the background thread calling TriceTransfer.
+static unsigned triceLinuxLost = 0; //!< triceLinuxLost counts the bytes lost on output errors.
+
+#define TRICE_SHM_MAGIC 0x53484d31 //!< TRICE_SHM_MAGIC marks an initialized shared memory ring.
+
+//! triceShm_t is the layout of a "shm:" output ring: a single producer single consumer byte ring like a SEGGER RTT up buffer.
+//! The target writes only wr and the data and the trice tool only rd. Both are free running byte counts on own cache lines.
+typedef struct{
+    volatile uint32_t magic; //!< magic is TRICE_SHM_MAGIC, when size, wr and rd are valid.
+    uint32_t size; //!< size is TRICE_SHM_SIZE.
+    uint32_t reserved0[14];
+    volatile uint32_t wr; //!< wr counts the bytes written by the target.
+    uint32_t reserved1[15];
+    volatile uint32_t rd; //!< rd counts the bytes read by the trice tool.
+    uint32_t reserved2[15];
+    uint8_t data[TRICE_SHM_SIZE]; //!< data starts at byte offset 192.
+} triceShm_t;
+
+static triceShm_t* triceLinuxShm = 0; //!< triceLinuxShm is the mapped "shm:" output ring or 0.
+
+//! triceLinuxShmOpen maps the shared memory object name as output ring and returns 0 or -1 with errno set.
+//! An existing ring with the same size is continued, so a restarted service does not disturb a running trice tool.
+static int triceLinuxShmOpen( char const* name ){
+    void* p;
+    int fd = shm_open( name, O_RDWR | O_CREAT | O_CLOEXEC, 0644 );
+    if( fd < 0 ){
+        return -1;
+    }
+    if( ftruncate( fd, sizeof(triceShm_t) ) != 0 ){
+        close( fd );
+        return -1;
+    }
+    p = mmap( 0, sizeof(triceShm_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd ); // the mapping stays
+    if( p == MAP_FAILED ){
+        return -1;
+    }
+    triceLinuxShm = p;
+    if( triceLinuxShm->magic != TRICE_SHM_MAGIC || triceLinuxShm->size != TRICE_SHM_SIZE ){
+        triceLinuxShm->size = TRICE_SHM_SIZE;
+        triceLinuxShm->wr = 0;
+        triceLinuxShm->rd = 0;
+        __atomic_store_n( &triceLinuxShm->magic, TRICE_SHM_MAGIC, __ATOMIC_RELEASE );
+    }
+    return 0;
+}
+
+//! triceLinuxShmWrite copies len bytes from buf into the output ring and publishes them. TriceOutDepth ensured the space.
+static void triceLinuxShmWrite( uint8_t const* buf, unsigned len ){
+    uint32_t wr = triceLinuxShm->wr;
+    uint32_t i = wr & (TRICE_SHM_SIZE-1);
+    uint32_t n = TRICE_SHM_SIZE - i < len ? TRICE_SHM_SIZE - i : len; // up to the ring end
+    memcpy( &triceLinuxShm->data[i], buf, n );
+    memcpy( &triceLinuxShm->data[0], buf + n, len - n );
+    __atomic_store_n( &triceLinuxShm->wr, wr + len, __ATOMIC_RELEASE ); // data visible before the new wr
+}
+
+//! triceLinuxConnect returns the connected Unix domain socket or -1, as long as no trice tool listens.
+static int triceLinuxConnect( void ){
+    int fd = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+    if( fd >= 0 && connect( fd, (struct sockaddr*)&triceLinuxAddress, sizeof(triceLinuxAddress) ) != 0 ){
+        close( fd );
+        fd = -1;
+    }
+    return fd;
+}
+
+//! triceRingPending returns !0, when a ring has a committed record.
+static int triceRingPending( void ){
+    for( unsigned core = 0; core < TRICE_RING_CORES; core++ ){
+        if( *(volatile uint32_t*)&triceRing[core][triceRingRead[core] & TRICE_RING_MASK] ){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+//! triceLinuxFlush is the flusher thread. It calls TriceTransfer every TRICE_TRANSFER_INTERVAL_MS milliseconds
+//! and, after TriceLinuxClose, until the ring is empty. So the services do all trice encoding and output here.
+static void* triceLinuxFlush( void* arg ){
+    struct timespec interval = { TRICE_TRANSFER_INTERVAL_MS / 1000, (TRICE_TRANSFER_INTERVAL_MS % 1000) * 1000000L };
+    sigset_t pipe;
+    sigemptyset( &pipe );
+    sigaddset( &pipe, SIGPIPE );
+    pthread_sigmask( SIG_BLOCK, &pipe, 0 ); // a closed pipe gives EPIPE instead of ending the service
+    while( triceLinuxRunning ){
+        TriceTransfer();
+        nanosleep( &interval, 0 );
+    }
+    while( triceRingPending() && 0 == TriceOutDepth() ){ // the committed records can exceed TRICE_RING_TRANSFER_SIZE
+        TriceTransfer();
+    }
+    return arg;
+}
+
+//! TriceLinuxOpen starts the trice output into path and the flusher thread.
+//! path is a file name, a named pipe, "unix:" followed by the socket path of a "trice log -port UNIX -args path"
+//! or "shm:" followed by the shared memory object name of a "trice log -port SHM:name", like "shm:/trice".
+//! A file gets appended. Opening a named pipe waits for the reader. A socket gets connected, as soon as the trice tool listens.
+//! A shared memory ring gets TRICE_SHM_SIZE bytes and is read by the trice tool without any system call.
+//! Until then and after output errors the trices wait inside the ring, and when it is full, new trices are dropped and counted.
+//! \retval 0 on success
+//! \retval -1 on error with errno set
+int TriceLinuxOpen( char const* path ){
+    int err;
+    if( 0 == strncmp( path, "unix:", 5 ) ){
+        path += 5;
+        if( strlen( path ) >= sizeof(triceLinuxAddress.sun_path) ){
+            errno = ENAMETOOLONG;
+            return -1;
+        }
+        triceLinuxAddress.sun_family = AF_UNIX;
+        strcpy( triceLinuxAddress.sun_path, path );
+        triceLinuxSocket = 1;
+        triceLinuxFd = triceLinuxConnect();
+    }else if( 0 == strncmp( path, "shm:", 4 ) ){
+        if( triceLinuxShmOpen( path + 4 ) != 0 ){
+            return -1;
+        }
+    }else{
+        triceLinuxFd = open( path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+        if( triceLinuxFd < 0 ){
+            return -1;
+        }
+    }
+    triceLinuxRunning = 1;
+    err = pthread_create( &triceLinuxFlusher, 0, triceLinuxFlush, 0 );
+    if( err ){
+        triceLinuxRunning = 0;
+        errno = err;
+        return -1;
+    }
+    return 0;
+}
+
+//! TriceLinuxClose stops the flusher thread after it wrote the remaining trices and closes the output.
+//! Trices written concurrently to TriceLinuxClose could stay inside the ring.
+void TriceLinuxClose( void ){
+    if( triceLinuxRunning ){
+        triceLinuxRunning = 0;
+        pthread_join( triceLinuxFlusher, 0 );
+    }
+    if( triceLinuxFd >= 0 ){
+        close( triceLinuxFd );
+    }
+    if( triceLinuxShm ){
+        munmap( triceLinuxShm, sizeof(triceShm_t) ); // the ring stays for the trice tool
+    }
+    triceLinuxFd = -1;
+    triceLinuxSocket = 0;
+    triceLinuxShm = 0;
+}
+
+//! TriceLinuxWrite writes len bytes from buf into the output. TriceTransfer calls it inside the flusher thread.
+//! On an output error the bytes are lost and counted. The output gets closed then and a socket reconnected with the next TriceTransfer.
+void TriceLinuxWrite( uint8_t const* buf, unsigned len ){
+    if( triceLinuxShm ){
+        triceLinuxShmWrite( buf, len );
+        return;
+    }
+    while( len ){
+        ssize_t n = triceLinuxSocket ? send( triceLinuxFd, buf, len, MSG_NOSIGNAL ) : write( triceLinuxFd, buf, len );
+        if( n < 0 && errno == EINTR ){
+            continue;
+        }
+        if( n <= 0 ){
+            triceLinuxLost += len;
+            close( triceLinuxFd );
+            triceLinuxFd = -1;
+            return;
+        }
+        buf += n;
+        len -= (unsigned)n;
+    }
+}
+
+//! TriceLinuxLostBytes returns the count of bytes lost on output errors.
+unsigned TriceLinuxLostBytes( void ){
+    return triceLinuxLost;
+}
+
+//! TriceOutDepth returns !0 without output, so that TriceTransfer leaves the trices inside the ring. It tries a socket reconnect first.
+//! A shared memory ring needs space for the biggest possible write, otherwise the trice tool did not read fast enough or is not running.
+int TriceOutDepth( void ){
+    if( triceLinuxShm ){
+        uint32_t used = triceLinuxShm->wr - __atomic_load_n( &triceLinuxShm->rd, __ATOMIC_ACQUIRE );
+        return TRICE_SHM_SIZE - used < sizeof(triceRingOut);
+    }
+    if( triceLinuxFd < 0 && triceLinuxSocket ){
+        triceLinuxFd = triceLinuxConnect();
+    }
+    return triceLinuxFd < 0;
+}
+#endif // #ifdef TRICE_LINUX
 
 //! TriceCOBSEncode stuffs "length" bytes of data at the location pointed to by "input"
 //! and writes the output to the location pointed to by "output".
@@ -184,32 +1174,105 @@ unsigned TriceCOBSEncode( uint8_t* restrict output, const uint8_t * restrict inp
     return write_index;
 }
 
-#ifdef TRICE_ENCRYPT // needs a re-design
+//! TRICE_HAS_ZERO_BYTE is !0, if one of the 4 bytes in v is 0.
+//! The subtraction sets bit 7 in each 0 byte. The "& ~v" masks bytes with bit 7 already set.
+#define TRICE_HAS_ZERO_BYTE( v ) (((v) - 0x01010101u) & ~(v) & 0x80808080u)
+
+//! TriceCOBSEncode32 is a drop-in replacement for TriceCOBSEncode with byte-identical output.
+//! It checks 4 input bytes at once for zeroes and copies zero-free words in one go.
+//! Only words containing a 0 or reaching the 254 bytes block limit are stuffed byte by byte.
+//! "input" must be 32-bit aligned, what trice data always are. A length not multiple of 4 is allowed.
+//! Returns the number of bytes written to "output".
+unsigned TriceCOBSEncode32( uint8_t* restrict output, const uint8_t * restrict input, unsigned length){
+    const uint32_t* in = (const uint32_t*)input;
+    unsigned words = length>>2;
+    unsigned read_index = words<<2;
+    unsigned write_index = 1;
+    unsigned code_index = 0;
+    uint8_t code = 1;
+    for( unsigned i = 0; i < words; i++ ){
+        uint32_t v = in[i];
+        if( !TRICE_HAS_ZERO_BYTE(v) && code < 0xFF-4 ){ // no 0 and no block end inside this word
+            memcpy( &output[write_index], &v, 4 ); // output is not aligned
+            write_index += 4;
+            code += 4;
+            continue;
+        }
+        for( unsigned k = 0; k < 4; k++ ){
+            uint8_t b = input[(i<<2)+k];
+            if( b == 0 ){
+                output[code_index] = code;
+                code = 1;
+                code_index = write_index++;
+            }else{
+                output[write_index++] = b;
+                code++;
+                if(code == 0xFF){
+                    output[code_index] = code;
+                    code = 1;
+                    code_index = write_index++;
+                }
+            }
+        }
+    }
+    while(read_index < length){ // remaining 1-3 bytes
+        if(input[read_index] == 0){
+            output[code_index] = code;
+            code = 1;
+            code_index = write_index++;
+            read_index++;
+        }else{
+            output[write_index++] = input[read_index++];
+            code++;
+            if(code == 0xFF){
+                output[code_index] = code;
+                code = 1;
+                code_index = write_index++;
+            }
+        }
+    }
+    output[code_index] = code;
+    return write_index;
+}
+
+#ifdef TRICE_ENCRYPT
 //! golang XTEA works with 64 rounds
 static const unsigned int numRounds = 64;
 
-//! 128 bit static key
-static const uint32_t k[4] = TRICE_ENCRYPT; 
+//! XTEA_SUM is the XTEA round sum after j additions of the constant delta 0x9E3779B9.
+#define XTEA_SUM(j) ((uint32_t)(j)*0x9E3779B9u)
 
-//! internal constant
-static const uint32_t delta = 0x9E3779B9;
+//! XTEA_KW selects key word i from k0...k3.
+#define XTEA_KW(k0,k1,k2,k3,i) ((i)==0 ? (k0) : (i)==1 ? (k1) : (i)==2 ? (k2) : (k3))
 
-//! precomputed values for faster execution
-static uint32_t table[64];
+//! XTEA_PAIR are the round table values for the 2 XTEA rounds of loop j.
+#define XTEA_PAIR(k0,k1,k2,k3,j) \
+    XTEA_SUM(j) + XTEA_KW(k0,k1,k2,k3,XTEA_SUM(j)&3), \
+    XTEA_SUM((j)+1) + XTEA_KW(k0,k1,k2,k3,(XTEA_SUM((j)+1)>>11)&3)
 
-//! TriceInitXteaTable precalculates the table.
-//! It is possible to put this table completely into FLASH by precomputing it during compile time.
-void TriceInitXteaTable( void ){
-    uint32_t sum = 0;
-    // Two rounds of XTEA applied per loop
-    for( int i = 0; i < numRounds; ) {
-        table[i] = sum + k[sum&3];
-        i++;
-        sum += delta;
-        table[i] = sum + k[(sum>>11)&3];
-        i++;
-    }
-}
+//! XTEA_PAIRS8 are the round table values for the loops j...j+7.
+#define XTEA_PAIRS8(k0,k1,k2,k3,j) \
+    XTEA_PAIR(k0,k1,k2,k3,(j)+0), XTEA_PAIR(k0,k1,k2,k3,(j)+1), XTEA_PAIR(k0,k1,k2,k3,(j)+2), XTEA_PAIR(k0,k1,k2,k3,(j)+3), \
+    XTEA_PAIR(k0,k1,k2,k3,(j)+4), XTEA_PAIR(k0,k1,k2,k3,(j)+5), XTEA_PAIR(k0,k1,k2,k3,(j)+6), XTEA_PAIR(k0,k1,k2,k3,(j)+7)
+
+//! XTEA_TABLE is the complete round table for the key words k0...k3.
+#define XTEA_TABLE(k0,k1,k2,k3) { \
+    XTEA_PAIRS8(k0,k1,k2,k3, 0), XTEA_PAIRS8(k0,k1,k2,k3, 8), \
+    XTEA_PAIRS8(k0,k1,k2,k3,16), XTEA_PAIRS8(k0,k1,k2,k3,24) }
+
+// Inside this file TRICE_ENCRYPT expands to the round table instead of the key.
+#undef XTEA_KEY
+#define XTEA_KEY(b00, b01, b02, b03, \
+                 b10, b11, b12, b13, \
+                 b20, b21, b22, b23, \
+                 b30, b31, b32, b33) XTEA_TABLE( \
+    0x##b00##b01##b02##b03##u, \
+    0x##b10##b11##b12##b13##u, \
+    0x##b20##b21##b22##b23##u, \
+    0x##b30##b31##b32##b33##u )
+
+//! table holds the precomputed round values. The compiler computes them from the key, so they are in FLASH.
+static const uint32_t table[64] = TRICE_ENCRYPT;
 
 // encipher converts 64 bits.
 //! Code taken and adapted from xtea\block.go
@@ -258,4 +1321,220 @@ void TriceEncrypt( uint32_t* p, unsigned count ){
     }
 }
 
+#ifdef TRICE_ENCRYPT_CTR
+static volatile uint32_t triceKeystream[TRICE_KEYSTREAM_BLOCKS][2]; //!< triceKeystream is a ring of precomputed keystream blocks.
+static volatile uint32_t triceKeystreamNext = 0; //!< triceKeystreamNext is the counter of the next keystream block to use.
+static volatile uint32_t triceKeystreamFilled = 0; //!< triceKeystreamFilled is the counter of the first not precomputed keystream block.
+
+//! triceKeystreamBlock computes the keystream block for counter c.
+//! \param ks gets the XTEA enciphered counter and nonce
+static void triceKeystreamBlock( uint32_t c, uint32_t ks[2] ){
+    ks[0] = c;
+    ks[1] = TRICE_CTR_NONCE;
+    encipher( ks );
+}
+
+//! TriceKeystreamFill precomputes keystream blocks until TRICE_KEYSTREAM_BLOCKS are ready.
+//! Call it in idle time, for example before each WFI. TriceEncryptCTR may interrupt it but not vice versa.
+void TriceKeystreamFill( void ){
+    for(;;){
+        uint32_t next = triceKeystreamNext;
+        uint32_t filled = triceKeystreamFilled;
+        uint32_t ks[2];
+        if( (int32_t)(filled - next) < 0 ){ // TriceEncryptCTR computed missing blocks itself
+            filled = next;
+        }
+        if( filled - next >= TRICE_KEYSTREAM_BLOCKS ){
+            return; // ring full
+        }
+        triceKeystreamBlock( filled, ks );
+        triceKeystream[filled % TRICE_KEYSTREAM_BLOCKS][0] = ks[0]; // This slot belongs to an already used block.
+        triceKeystream[filled % TRICE_KEYSTREAM_BLOCKS][1] = ks[1];
+        triceKeystreamFilled = filled + 1;
+    }
+}
+
+//! TriceEncryptCTR encrypts count words starting at p+2 in counter mode.
+//! The counter of the first used keystream block and the nonce are written into p[0] and p[1] for the receiver.
+//! Precomputed keystream blocks make this a word XOR. Missing blocks are computed here.
+//! \param p pointer to 2 header words followed by the count words to encrypt
+void TriceEncryptCTR( uint32_t* p, unsigned count ){
+    uint32_t c = triceKeystreamNext;
+    p[0] = c;
+    p[1] = TRICE_CTR_NONCE;
+    p += 2;
+    for( unsigned i = 0; i < count; i += 2, c++ ){
+        uint32_t ks[2];
+        if( (int32_t)(triceKeystreamFilled - c) > 0 ){ // precomputed
+            ks[0] = triceKeystream[c % TRICE_KEYSTREAM_BLOCKS][0];
+            ks[1] = triceKeystream[c % TRICE_KEYSTREAM_BLOCKS][1];
+        }else{
+            triceKeystreamBlock( c, ks );
+        }
+        p[i] ^= ks[0];
+        if( i + 1 < count ){ // The last block is possibly used only half.
+            p[i+1] ^= ks[1];
+        }
+    }
+    triceKeystreamNext = c;
+}
+#endif // #ifdef TRICE_ENCRYPT_CTR
+
 #endif // #ifdef TRICE_ENCRYPT
+
+#ifdef TRICE_FUNCTIONS
+// The TriceCall32n body is the inline TRICE macro code. The TRICE_CALL macro checks the level and selects the urgent buffer already.
+#undef TRICE_LEVEL_ENABLED
+#define TRICE_LEVEL_ENABLED( id ) 1
+#undef TRICE_LANE
+#define TRICE_LANE( id )
+#undef TRICE_LANE_END
+#define TRICE_LANE_END
+#undef TRICE_PREFIX_LOCATION
+#define TRICE_PREFIX_LOCATION location
+#ifdef TRICE_LOCATION
+#define TRICE_CALL_LOCATION_ARG location, //!< TRICE_CALL_LOCATION_ARG passes the location parameter on.
+#else
+#define TRICE_CALL_LOCATION_ARG
+#endif
+#ifdef __GNUC__
+#define TRICE_NOINLINE __attribute__((noinline)) //!< TRICE_NOINLINE keeps the compiler from copying the core functions into each TriceCall function again.
+#else
+#define TRICE_NOINLINE
+#endif
+
+//! TriceCall32n writes a trice with count 32-bit parameter words v. All TriceCall functions except TriceCallN end here.
+TRICE_NOINLINE void TriceCall32n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v ){
+    TRICE_INTO( id )
+    TRICE_PUT( id | (count<<8) | TRICE_CYCLE );
+    for( uint32_t i = 0; i < count; i++ ){
+        TRICE_PUT( v[i] );
+    }
+    TRICE_OUTOF
+}
+
+//! TriceCall8n packs count 8-bit values v into words like the TRICE8 macros and writes them as trice.
+TRICE_NOINLINE void TriceCall8n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v ){
+    uint32_t w[3] = {0};
+    for( uint32_t i = 0; i < count; i++ ){
+        w[i>>2] |= (uint32_t)(uint8_t)v[i] << ((i&3)<<3);
+    }
+    TriceCall32n( TRICE_CALL_LOCATION_ARG id, (count+3)>>2, w );
+}
+
+//! TriceCall16n packs count 16-bit values v into words like the TRICE16 macros and writes them as trice.
+TRICE_NOINLINE void TriceCall16n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v ){
+    uint32_t w[6] = {0};
+    for( uint32_t i = 0; i < count; i++ ){
+        w[i>>1] |= (uint32_t)(uint16_t)v[i] << ((i&1)<<4);
+    }
+    TriceCall32n( TRICE_CALL_LOCATION_ARG id, (count+1)>>1, w );
+}
+
+//! TriceCall64n splits count 64-bit values v into words like the TRICE64 macros and writes them as trice.
+TRICE_NOINLINE void TriceCall64n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint64_t const* v ){
+    uint32_t w[24];
+    for( uint32_t i = 0; i < count; i++ ){
+        #ifdef TRICE_BIG_ENDIANNESS
+        w[2*i] = (uint32_t)(v[i]>>32);
+        w[2*i+1] = (uint32_t)v[i];
+        #else
+        w[2*i] = (uint32_t)v[i];
+        w[2*i+1] = (uint32_t)(v[i]>>32);
+        #endif
+    }
+    TriceCall32n( TRICE_CALL_LOCATION_ARG id, 2*count, w );
+}
+
+// The TriceCallX_n functions only collect their values for the core functions.
+void TriceCall0( TRICE_CALL_LOCATION_PARAM uint32_t id ){ TriceCall32n( TRICE_CALL_LOCATION_ARG id, 0, 0 ); }
+void TriceCall8_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 ){ uint32_t const v[] = { v0 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 1, v ); }
+void TriceCall8_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 ){ uint32_t const v[] = { v0, v1 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 2, v ); }
+void TriceCall8_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 ){ uint32_t const v[] = { v0, v1, v2 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 3, v ); }
+void TriceCall8_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){ uint32_t const v[] = { v0, v1, v2, v3 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 4, v ); }
+void TriceCall8_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){ uint32_t const v[] = { v0, v1, v2, v3, v4 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 5, v ); }
+void TriceCall8_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 6, v ); }
+void TriceCall8_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 7, v ); }
+void TriceCall8_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 8, v ); }
+void TriceCall8_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 9, v ); }
+void TriceCall8_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 10, v ); }
+void TriceCall8_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 11, v ); }
+void TriceCall8_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 }; TriceCall8n( TRICE_CALL_LOCATION_ARG id, 12, v ); }
+void TriceCall16_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 ){ uint32_t const v[] = { v0 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 1, v ); }
+void TriceCall16_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 ){ uint32_t const v[] = { v0, v1 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 2, v ); }
+void TriceCall16_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 ){ uint32_t const v[] = { v0, v1, v2 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 3, v ); }
+void TriceCall16_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){ uint32_t const v[] = { v0, v1, v2, v3 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 4, v ); }
+void TriceCall16_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){ uint32_t const v[] = { v0, v1, v2, v3, v4 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 5, v ); }
+void TriceCall16_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 6, v ); }
+void TriceCall16_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 7, v ); }
+void TriceCall16_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 8, v ); }
+void TriceCall16_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 9, v ); }
+void TriceCall16_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 10, v ); }
+void TriceCall16_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 11, v ); }
+void TriceCall16_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 }; TriceCall16n( TRICE_CALL_LOCATION_ARG id, 12, v ); }
+void TriceCall32_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 ){ uint32_t const v[] = { v0 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 1, v ); }
+void TriceCall32_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 ){ uint32_t const v[] = { v0, v1 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 2, v ); }
+void TriceCall32_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 ){ uint32_t const v[] = { v0, v1, v2 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 3, v ); }
+void TriceCall32_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){ uint32_t const v[] = { v0, v1, v2, v3 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 4, v ); }
+void TriceCall32_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){ uint32_t const v[] = { v0, v1, v2, v3, v4 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 5, v ); }
+void TriceCall32_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 6, v ); }
+void TriceCall32_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 7, v ); }
+void TriceCall32_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 8, v ); }
+void TriceCall32_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 9, v ); }
+void TriceCall32_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 10, v ); }
+void TriceCall32_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 11, v ); }
+void TriceCall32_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){ uint32_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 }; TriceCall32n( TRICE_CALL_LOCATION_ARG id, 12, v ); }
+void TriceCall64_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0 ){ uint64_t const v[] = { v0 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 1, v ); }
+void TriceCall64_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1 ){ uint64_t const v[] = { v0, v1 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 2, v ); }
+void TriceCall64_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2 ){ uint64_t const v[] = { v0, v1, v2 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 3, v ); }
+void TriceCall64_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3 ){ uint64_t const v[] = { v0, v1, v2, v3 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 4, v ); }
+void TriceCall64_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4 ){ uint64_t const v[] = { v0, v1, v2, v3, v4 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 5, v ); }
+void TriceCall64_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 6, v ); }
+void TriceCall64_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 7, v ); }
+void TriceCall64_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 8, v ); }
+void TriceCall64_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 9, v ); }
+void TriceCall64_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 10, v ); }
+void TriceCall64_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 11, v ); }
+void TriceCall64_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11 ){ uint64_t const v[] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 }; TriceCall64n( TRICE_CALL_LOCATION_ARG id, 12, v ); }
+void TriceCallN( TRICE_CALL_LOCATION_PARAM uint32_t id, void const* buf, uint32_t len ){ TRICE_N( id, "", buf, len ); }
+#undef TRICE_PREFIX_LOCATION
+#define TRICE_PREFIX_LOCATION TRICE_LOCATION
+#endif // #ifdef TRICE_FUNCTIONS
+
+#ifdef TRICE_FUNCTION_TRACE
+// The function events are control records with ID 0, so they use never the urgent buffer.
+// Compile trice.c and the TRICE_WRITE code without -finstrument-functions, otherwise the hooks call themselves.
+#undef TRICE_LANE
+#define TRICE_LANE( id )
+#undef TRICE_LANE_END
+#define TRICE_LANE_END
+
+//! triceFunctionEvent writes a function enter or exit control record with the lower half of the absolute clock value.
+//! The trice tool unwraps the clock values, so interrupting events and dropped records do not disturb the other events.
+__attribute__((no_instrument_function)) static void triceFunctionEvent( unsigned type, void* fn ){
+    uint16_t clock = (uint16_t)TRICE_FUNCTION_CLOCK();
+    uintptr_t addr = (uintptr_t)fn;
+    TRICE_CONTROL_INTO( 0 )
+    #if UINTPTR_MAX > 0xFFFFFFFF
+    TRICE_PUT( TRICE_CONTROL_HEAD( type, clock, 2 ) );
+    TRICE_PUT( (uint32_t)addr );
+    TRICE_PUT( (uint32_t)(addr >> 32) );
+    #else
+    TRICE_PUT( TRICE_CONTROL_HEAD( type, clock, 1 ) );
+    TRICE_PUT( addr );
+    #endif
+    TRICE_CONTROL_OUTOF
+}
+
+//! __cyg_profile_func_enter is called by code compiled with -finstrument-functions on each function entry.
+__attribute__((no_instrument_function)) void __cyg_profile_func_enter( void* fn, void* callSite ){
+    (void)callSite;
+    triceFunctionEvent( TRICE_CONTROL_FUNCTION_ENTER, fn );
+}
+
+//! __cyg_profile_func_exit is called by code compiled with -finstrument-functions on each function exit.
+__attribute__((no_instrument_function)) void __cyg_profile_func_exit( void* fn, void* callSite ){
+    (void)callSite;
+    triceFunctionEvent( TRICE_CONTROL_FUNCTION_EXIT, fn );
+}
+#endif // #ifdef TRICE_FUNCTION_TRACE
@@ -6,6 +6,7 @@ package src
 // #include <stdint.h>
 // #include "trice_test.h"
 // #include "trice.h"
+// #include "tcobs.h"
 // #cgo CFLAGS: -g -Wall -Iinc
 import "C"
 import (
@@ -23,3 +24,27 @@ func setTriceBuffer(o []byte) {
 func triceCode(n int) int {
 	return int(C.TriceCode(C.int(n)))
 }
+
+// triceCOBSEncode encodes i into o and returns the encoded length.
+// It is simply a Go wrapper for the C function TriceCOBSEncode.
+func triceCOBSEncode(o, i []byte) int {
+	Cout := (*C.uint8_t)(unsafe.Pointer(&o[0]))
+	Cin := (*C.uint8_t)(unsafe.Pointer(&i[0]))
+	return int(C.TriceCOBSEncode(Cout, Cin, C.unsigned(len(i))))
+}
+
+// triceCOBSEncode32 encodes i into o and returns the encoded length.
+// It is simply a Go wrapper for the C function TriceCOBSEncode32.
+func triceCOBSEncode32(o, i []byte) int {
+	Cout := (*C.uint8_t)(unsafe.Pointer(&o[0]))
+	Cin := (*C.uint8_t)(unsafe.Pointer(&i[0]))
+	return int(C.TriceCOBSEncode32(Cout, Cin, C.unsigned(len(i))))
+}
+
+// tcobsEncode encodes i into o and returns the encoded length.
+// It is simply a Go wrapper for the C function TCOBSEncode.
+func tcobsEncode(o, i []byte) int {
+	Cout := unsafe.Pointer(&o[0])
+	Cin := unsafe.Pointer(&i[0])
+	return int(C.TCOBSEncode(Cout, Cin, C.size_t(len(i))))
+}
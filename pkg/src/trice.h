@@ -7,12 +7,14 @@
 
 #ifdef TRICE_OFF // do not generate trice code for files defining TRICE_OFF before including "trice.h"
 #define TRICE_CYCLE_COUNTER 0 // why needed here?
-#define TRICE_INTO
+#define TRICE_INTO( id )
 #define TRICE_PUT(n) do{ ((void)(n)); }while(0)
 #define PUT_BUFFER(b,l) do{ ((void)(b)); ((void)(l)); }while(0)
 #define TRICE_LEAVE
+#define TRICE_OUTOF
 #define TRICE_S( id, p, s )  do{ ((void)(id)); ((void)(p)); ((void)(s)); }while(0)
 #define TRICE_N( id, p, s, n )  do{ ((void)(id)); ((void)(p)); ((void)(s)); ((void)(n)); }while(0)
+#define TRICE_SPAN( id, type ) do{ ((void)(id)); }while(0)
 #endif
 
 #include "triceConfig.h"
@@ -27,21 +29,79 @@ extern "C" {
 // Declarations and Defaults
 
 #ifndef TRICE_COMMAND_SIZE_MAX
+#ifdef TRICE_ID_BITMAP_BITS
+#define TRICE_COMMAND_SIZE_MAX 8 //!< trice tool could transmit command strings to target, like "@-65535"
+#else
 #define TRICE_COMMAND_SIZE_MAX 4 //!< trice tool could transmit command strings to target
 #endif
+#endif
 extern char triceCommand[TRICE_COMMAND_SIZE_MAX+1];
 extern int triceCommandFlag;
 
+#if defined(TRICE_HALF_BUFFER_SIZE) && defined(TRICE_RING_BUFFER_SIZE)
+#error "Use only one of TRICE_HALF_BUFFER_SIZE and TRICE_RING_BUFFER_SIZE."
+#endif
+
+#if defined(TRICE_HALF_BUFFER_SIZE) || defined(TRICE_RING_BUFFER_SIZE)
+#define TRICE_DEFERRED_OUT //!< TRICE_DEFERRED_OUT is defined, when the trice output is done later inside TriceTransfer and not inside the TRICE macros.
+#endif
+
 size_t TriceDepthMax( void );
 #ifdef TRICE_HALF_BUFFER_SIZE
 extern uint32_t* TriceBufferWritePosition;
 #endif
-unsigned TriceCOBSEncode( uint8_t* restrict output, const uint8_t * restrict input, unsigned length);
+#if defined(TRICE_BUFFER_OVERFLOW_PROTECTION) && defined(TRICE_HALF_BUFFER_SIZE)
+extern uint32_t* TriceBufferSoftLimit;
+void TriceBufferDrop( uint32_t* start );
+unsigned TriceDroppedTrices( void );
+unsigned TriceDroppedBytes( void );
+#endif
+#if defined(TRICE_FLUSH_HIGH_WATER) && defined(TRICE_HALF_BUFFER_SIZE)
+extern uint32_t* TriceFlushLimit;
+#endif
+#if defined(TRICE_RING_BUFFER_SIZE) && !defined(TRICE_RING_TRANSFER_SIZE)
+#define TRICE_RING_TRANSFER_SIZE (TRICE_RING_BUFFER_SIZE/2) //!< TRICE_RING_TRANSFER_SIZE is the max byte count TriceTransfer moves in one go from the ring into the output buffer.
+#endif
+#if defined(TRICE_RING_BUFFER_SIZE) && !defined(TRICE_RING_CORES)
+#define TRICE_RING_CORES 1 //!< TRICE_RING_CORES is the ring count. On SMP targets each core gets an own ring with an own cycle counter.
+#endif
+#if defined(TRICE_RING_CORES) && TRICE_RING_CORES > 1
+#if !defined(TRICE_CORE_ID) && defined(TRICE_LINUX)
+#include <sched.h>
+//! TRICE_CORE_ID selects the ring of the CPU the thread runs on. sched_getcpu needs _GNU_SOURCE.
+#define TRICE_CORE_ID() ((unsigned)sched_getcpu() % TRICE_RING_CORES)
+#endif
+#ifndef TRICE_CORE_ID
+#error "TRICE_RING_CORES needs TRICE_CORE_ID() returning the core number 0 to TRICE_RING_CORES-1."
+#endif
+#if TRICE_RING_CORES > 256 || defined(TRICE_DELTA_TIMESTAMP) || defined(TRICE_PACKED_PARAMS)
+#error "TRICE_RING_CORES must be up to 256. The trice tool splits the packages into single trices for merging, so no delta timestamps or packed parameters."
+#endif
+#endif
+#ifndef TRICE_CORE_ID
+#define TRICE_CORE_ID() 0 //!< TRICE_CORE_ID is the ring index of the calling core.
+#endif
+#ifdef TRICE_RING_BUFFER_SIZE
+void TriceRingWrite( uint32_t const* buf, unsigned count );
+unsigned TriceRingDropped( void );
+#endif
+unsigned TriceCOBSEncode( uint8_t* output, const uint8_t * input, unsigned length);
+unsigned TriceCOBSEncode32( uint8_t* output, const uint8_t * input, unsigned length);
+#ifdef TRICE_TCOBS
+#include "tcobs.h"
+#ifdef TRICE_COBS_ENCODE
+#error "TRICE_TCOBS selects the TRICE_COBS_ENCODE function."
+#endif
+#define TRICE_COBS_ENCODE TCOBSEncode //!< TCOBS framing: trice tool needs "-encoding TCOBS".
+#endif
+#ifndef TRICE_COBS_ENCODE
+#define TRICE_COBS_ENCODE TriceCOBSEncode //!< TRICE_COBS_ENCODE is the COBS encoder used inside TriceOut. TriceCOBSEncode32 is faster with more code.
+#endif
 void TriceOut( uint32_t* tb, size_t tLen );
 void TriceTransfer( void );
 void TriceCheckSet( int index ); //!< tests
 
-#if defined( TRICE_UART ) && !defined( TRICE_HALF_BUFFER_SIZE ) // direct out to UART
+#if defined( TRICE_UART ) && !defined( TRICE_DEFERRED_OUT ) // direct out to UART
 #define TRICE_WRITE( buf, len ) do{ TriceBlockingWrite( buf, len ); }while(0)
 #endif
 
@@ -50,6 +110,9 @@ void TriceCheckSet( int index ); //!< tests
 #if defined(TRICE_HALF_BUFFER_SIZE) && TRICE_HALF_BUFFER_SIZE > BUFFER_SIZE_UP
 #error
 #endif
+#if defined(TRICE_RING_TRANSFER_SIZE) && TRICE_RING_TRANSFER_SIZE > BUFFER_SIZE_UP
+#error
+#endif
 #if defined(TRICE_STACK_BUFFER_SIZE) && TRICE_STACK_BUFFER_SIZE > BUFFER_SIZE_UP
 #error
 #endif
@@ -58,36 +121,77 @@ static inline int TriceOutDepth( void ){ return 0; }
 #endif // #ifdef TRICE_RTT_CHANNEL
 
 //! The TRICE_PUT_PREFIX macro adds optionally target timestamp and location in front of each trice
+#define TRICE_PREFIX_LOCATION TRICE_LOCATION //!< TRICE_PREFIX_LOCATION is the location value. The TRICE functions in trice.c replace it with the location of the call site.
 #if !defined(TRICE_LOCATION) && !defined(TRICE_TIMESTAMP)
-#define TRICE_COBS_PACKAGE_MODE 0
+#define TRICE_COBS_PACKAGE_MODE (0|TRICE_COBS_FLAGS)
 #define TRICE_PUT_PREFIX
 #define TRICE_PREFIX_SIZE 0
 #endif
 #if !defined(TRICE_LOCATION) &&  defined(TRICE_TIMESTAMP)
-#define TRICE_COBS_PACKAGE_MODE 1
+#define TRICE_COBS_PACKAGE_MODE (1|TRICE_COBS_FLAGS)
 #define TRICE_PUT_PREFIX TRICE_PUT(TRICE_TIMESTAMP);
 #define TRICE_PREFIX_SIZE 4
 #endif
 #if  defined(TRICE_LOCATION) && !defined(TRICE_TIMESTAMP)
-#define TRICE_COBS_PACKAGE_MODE 2
-#define TRICE_PUT_PREFIX TRICE_PUT(TRICE_LOCATION); 
+#define TRICE_COBS_PACKAGE_MODE (2|TRICE_COBS_FLAGS)
+#define TRICE_PUT_PREFIX TRICE_PUT(TRICE_PREFIX_LOCATION); 
 #define TRICE_PREFIX_SIZE 4
 #endif
 #if  defined(TRICE_LOCATION) &&  defined(TRICE_TIMESTAMP)
-#define TRICE_COBS_PACKAGE_MODE 3
-#define TRICE_PUT_PREFIX TRICE_PUT(TRICE_LOCATION); TRICE_PUT(TRICE_TIMESTAMP); 
+#define TRICE_COBS_PACKAGE_MODE (3|TRICE_COBS_FLAGS)
+#define TRICE_PUT_PREFIX TRICE_PUT(TRICE_PREFIX_LOCATION); TRICE_PUT(TRICE_TIMESTAMP); 
 #define TRICE_PREFIX_SIZE 8
 #endif
 
+#ifdef TRICE_DELTA_TIMESTAMP
+#ifndef TRICE_TIMESTAMP
+#error "TRICE_DELTA_TIMESTAMP needs TRICE_TIMESTAMP."
+#endif
+#define TRICE_COBS_DELTA_FLAG 4 //!< Bit 2 signals one absolute timestamp per package and a 16- or 32-bit delta per trice.
+#define TRICE_DELTA_HEADER_SIZE 4 //!< TRICE_DELTA_HEADER_SIZE is the space for the absolute package timestamp.
+#else
+#define TRICE_COBS_DELTA_FLAG 0
+#define TRICE_DELTA_HEADER_SIZE 0 //!< TRICE_DELTA_HEADER_SIZE is the space for the absolute package timestamp.
+#endif
+
+#ifdef TRICE_PACKED_PARAMS
+#define TRICE_COBS_PACKED_FLAG 8 //!< Bit 3 signals zigzag varint packed parameters in trices with head bit 15 set.
+#else
+#define TRICE_COBS_PACKED_FLAG 0
+#endif
+
+#define TRICE_COBS_FLAGS (TRICE_COBS_DELTA_FLAG|TRICE_COBS_PACKED_FLAG) //!< TRICE_COBS_FLAGS are the optional package descriptor bits.
+#define TRICE_COBS_PRE_RESET_FLAG 16 //!< Bit 4 signals a package retained in no-init RAM over a target reset.
+#define TRICE_COBS_URGENT_FLAG 32 //!< Bit 5 signals a package from the urgent buffer. Its trices do not advance the cycle counter.
+#define TRICE_COBS_CORE_FLAG 64 //!< Bit 6 signals a package from one of TRICE_RING_CORES rings with the core number in bits 15..8. Each core has its own cycle counter.
+
 #ifndef TRICE_CYCLE_COUNTER
 #define TRICE_CYCLE_COUNTER 1 //! TRICE_CYCLE_COUNTER adds a cycle counter to each trice message. The TRICE macros are a bit slower. Lost TRICEs are detectable by the trice tool.
 #endif
 
+#ifdef TRICE_TCOBS
+#define TRICE_ENCODING_OVERHEAD(n) ((n)/31) //!< TCOBS adds a sigil byte after 31 literal bytes in the worst case.
+#else
+#define TRICE_ENCODING_OVERHEAD(n) ((n)/256) //!< COBS adds a code byte after 254 bytes.
+#endif
+
+#if defined(TRICE_ENCRYPT_CTR) && !defined(TRICE_ENCRYPT)
+#error "TRICE_ENCRYPT_CTR needs TRICE_ENCRYPT with the key."
+#endif
+
+#ifdef TRICE_ENCRYPT_CTR
+#define TRICE_CIPHER_HEADER_SIZE 8 //!< TRICE_CIPHER_HEADER_SIZE is the space for the keystream counter and nonce in front of each package.
+#else
+#define TRICE_CIPHER_HEADER_SIZE 0 //!< TRICE_CIPHER_HEADER_SIZE is the space for cipher information in front of each package.
+#endif
+
 //! TRICE_DATA_OFFSET is the space in front of trice data for in-buffer COBS encoding. It must be be a multiple of uint32_t.
 #if defined(TRICE_HALF_BUFFER_SIZE)
-#define TRICE_DATA_OFFSET ((9+(TRICE_HALF_BUFFER_SIZE/256))&~3) // 9: COBS_DESCRIPTOR size plus start byte plus up to 4 0-delimiters
+#define TRICE_DATA_OFFSET ((9+TRICE_CIPHER_HEADER_SIZE+TRICE_DELTA_HEADER_SIZE+TRICE_ENCODING_OVERHEAD(TRICE_HALF_BUFFER_SIZE))&~3) // 9: COBS_DESCRIPTOR size plus start byte plus up to 4 0-delimiters
+#elif defined(TRICE_RING_BUFFER_SIZE)
+#define TRICE_DATA_OFFSET ((9+TRICE_CIPHER_HEADER_SIZE+TRICE_DELTA_HEADER_SIZE+TRICE_ENCODING_OVERHEAD(TRICE_RING_TRANSFER_SIZE))&~3) // 9: COBS_DESCRIPTOR size plus start byte plus up to 4 0-delimiters
 #else
-#define TRICE_DATA_OFFSET 16 // usually 8 is enough: 4 for COBS_DESCRIPTOR and additional bytes for COBS encoding, but the buffer can get big.
+#define TRICE_DATA_OFFSET (16+TRICE_CIPHER_HEADER_SIZE+TRICE_DELTA_HEADER_SIZE) // usually 8 is enough: 4 for COBS_DESCRIPTOR and additional bytes for COBS encoding, but the buffer can get big.
 #endif
 
 #if defined(TRICE_STACK_BUFFER_MAX_SIZE) && !defined(TRICE_SINGLE_MAX_SIZE)
@@ -102,6 +206,14 @@ static inline int TriceOutDepth( void ){ return 0; }
 #error
 #endif
 
+#if defined(TRICE_PACKED_PARAMS) && TRICE_SINGLE_MAX_SIZE > 512
+#error "TRICE_PACKED_PARAMS uses head bit 15, so the length byte must stay below 128."
+#endif
+
+#if defined(TRICE_TCOBS) && !defined(TRICE_DEFERRED_OUT) && TRICE_SINGLE_MAX_SIZE > 300
+#error "TRICE_DATA_OFFSET 16 is too small for TCOBS in-buffer encoding of so big trices."
+#endif
+
 #if defined(TRICE_STACK_BUFFER_MAX_SIZE) && defined(TRICE_SINGLE_MAX_SIZE) && TRICE_SINGLE_MAX_SIZE + TRICE_DATA_OFFSET > TRICE_STACK_BUFFER_MAX_SIZE
 #error
 #endif
@@ -110,13 +222,127 @@ static inline int TriceOutDepth( void ){ return 0; }
 #error
 #endif
 
+#if defined(TRICE_HALF_BUFFER_SIZE) && !defined(TRICE_BUFFER_SLOTS)
+#define TRICE_BUFFER_SLOTS 2 //!< TRICE_BUFFER_SLOTS is the count of TRICE_HALF_BUFFER_SIZE buffers. 2 is a double buffer, more slots queue packages while a transmission is running.
+#endif
+
+#if defined(TRICE_BUFFER_SLOTS) && TRICE_BUFFER_SLOTS < 2
+#error "TRICE_BUFFER_SLOTS must be at least 2."
+#endif
+
+#ifdef TRICE_NOINIT
+#ifndef TRICE_HALF_BUFFER_SIZE
+#error "TRICE_NOINIT needs TRICE_HALF_BUFFER_SIZE."
+#endif
+void TriceInit( void );
+#endif
+
+#ifdef TRICE_URGENT_BUFFER_SIZE
+#ifndef TRICE_HALF_BUFFER_SIZE
+#error "TRICE_URGENT_BUFFER_SIZE needs TRICE_HALF_BUFFER_SIZE."
+#endif
+#if TRICE_URGENT_BUFFER_SIZE < TRICE_SINGLE_MAX_SIZE + TRICE_DATA_OFFSET || (TRICE_URGENT_BUFFER_SIZE & 3)
+#error "TRICE_URGENT_BUFFER_SIZE must be a multiple of 4 with space for TRICE_SINGLE_MAX_SIZE."
+#endif
+void TriceUrgentEnter( void );
+void TriceUrgentLeave( void );
+//! TRICE_URGENT writes trice into the urgent buffer, like TRICE_URGENT( TRICE( Id(0), "err:x=%d\n", x ) );.
+//! TriceTransfer sends the urgent buffer before all other trices.
+#define TRICE_URGENT( trice ) do{ TRICE_ENTER_CRITICAL_SECTION TriceUrgentEnter(); trice; TriceUrgentLeave(); TRICE_LEAVE_CRITICAL_SECTION }while(0)
+#else
+#define TRICE_URGENT( trice ) do{ trice; }while(0) //!< TRICE_URGENT is a normal trice without TRICE_URGENT_BUFFER_SIZE.
+#endif
+
+#ifdef TRICE_FRAGMENTS
+#ifndef TRICE_FRAGMENT_SIZE
+#define TRICE_FRAGMENT_SIZE ((TRICE_SINGLE_MAX_SIZE - TRICE_PREFIX_SIZE - 12) & ~3) //!< TRICE_FRAGMENT_SIZE is the max buffer byte count inside one fragment. 12 = head, length and offset size.
+#endif
+#if TRICE_FRAGMENT_SIZE < 4 || (TRICE_FRAGMENT_SIZE & 3) || TRICE_FRAGMENT_SIZE + TRICE_PREFIX_SIZE + 12 > TRICE_SINGLE_MAX_SIZE
+#error "TRICE_FRAGMENT_SIZE must be a multiple of 4 and a fragment must fit into TRICE_SINGLE_MAX_SIZE."
+#endif
+#ifndef TRICE_FRAGMENT_WAIT
+#define TRICE_FRAGMENT_WAIT() TriceTransfer() //!< TRICE_FRAGMENT_WAIT is called, while the next fragment does not fit into the write buffer slot.
+#endif
+void TriceFragments( uint32_t id, void const* buf, uint32_t len );
+#define TRICE_N_FRAGMENTS( id, buf, len ) { TriceFragments( id, buf, len ); break; } //!< TRICE_N_FRAGMENTS streams an oversized TRICE_N buffer instead of truncating it.
+#else
+#define TRICE_N_FRAGMENTS( id, buf, len )
+#endif
+
+#ifdef TRICE_ZERO_COPY
+#if !defined(TRICE_HALF_BUFFER_SIZE) || defined(TRICE_UART) || defined(TRICE_NOINIT) || defined(TRICE_DELTA_TIMESTAMP) || defined(TRICE_PACKED_PARAMS) || defined(TRICE_ENCRYPT) || defined(TRICE_TCOBS)
+#error "TRICE_ZERO_COPY needs TRICE_HALF_BUFFER_SIZE and a TRICE_WRITE for consecutive calls like SEGGER_RTT_Write. It does not work with TRICE_NOINIT and the package transformations."
+#endif
+#ifndef TRICE_ZERO_COPY_MIN
+#define TRICE_ZERO_COPY_MIN 32 //!< TRICE_ZERO_COPY_MIN is the smallest buffer byte count written by reference. Smaller buffers are copied.
+#endif
+#ifndef TRICE_ZERO_COPY_REFERENCES
+#define TRICE_ZERO_COPY_REFERENCES 8 //!< TRICE_ZERO_COPY_REFERENCES is the max count of buffer references in each buffer slot. More buffers are copied.
+#endif
+extern int TriceByReference;
+int TriceReference( void const* buf, uint32_t len );
+int TriceReferenced( void const* buf, uint32_t len );
+//! TRICE_BY_REFERENCE writes only a reference of the TRICE_N or TRICE_S buffer inside trice into the trice buffer, like TRICE_BY_REFERENCE( TRICE_N( Id(0), "dump:%s\n", adc, sizeof(adc) ) );.
+//! TriceTransfer COBS encodes the buffer straight from there, so it must stay unchanged as long as TriceReferenced( adc, sizeof(adc) ) returns 1.
+#define TRICE_BY_REFERENCE( trice ) do{ TRICE_ENTER_CRITICAL_SECTION TriceByReference = 1; trice; TriceByReference = 0; TRICE_LEAVE_CRITICAL_SECTION }while(0)
+//! TRICE_PUTBUFFER copies a buffer into the TRICE buffer or, inside TRICE_BY_REFERENCE, writes only a reference.
+#define TRICE_PUTBUFFER( buf, len ) do{ \
+    if( !TriceByReference || (len) < TRICE_ZERO_COPY_MIN || !TriceReference( buf, len ) ){ \
+        memcpy( TriceBufferWritePosition, buf, len ); \
+        TriceBufferWritePosition += (len+3)>>2; \
+    } \
+}while(0)
+#else
+#define TRICE_BY_REFERENCE( trice ) do{ trice; }while(0) //!< TRICE_BY_REFERENCE is a normal trice without TRICE_ZERO_COPY.
+#endif
+
+#if defined(TRICE_BUFFER_OVERFLOW_PROTECTION) && defined(TRICE_HALF_BUFFER_SIZE)
+//! TRICE_BUFFER_SLACK is the space behind the soft limit. A trice starting below the soft limit ends always inside the buffer.
+#if TRICE_SINGLE_MAX_SIZE > TRICE_PREFIX_SIZE + 100
+#define TRICE_BUFFER_SLACK TRICE_SINGLE_MAX_SIZE
+#else
+#define TRICE_BUFFER_SLACK (TRICE_PREFIX_SIZE + 100) // 100: head and TRICE64_12 values
+#endif
+#define TRICE_LOST_RECORD_SIZE (TRICE_PREFIX_SIZE + 8) //!< TRICE_LOST_RECORD_SIZE is the space reserved at the buffer end for a LOST control record.
+#define TRICE_BUFFER_SOFT_LIMIT (TRICE_HALF_BUFFER_SIZE - TRICE_BUFFER_SLACK - TRICE_LOST_RECORD_SIZE) //!< TRICE_BUFFER_SOFT_LIMIT is the byte offset inside a half buffer, where trices get dropped.
+#if TRICE_BUFFER_SOFT_LIMIT < TRICE_DATA_OFFSET + TRICE_SINGLE_MAX_SIZE
+#error "TRICE_HALF_BUFFER_SIZE is too small for TRICE_BUFFER_OVERFLOW_PROTECTION."
+#endif
+#endif
+
+#if defined(TRICE_RING_BUFFER_SIZE) && (TRICE_RING_BUFFER_SIZE & (TRICE_RING_BUFFER_SIZE-1)) != 0
+#error "TRICE_RING_BUFFER_SIZE must be a power of 2."
+#endif
+
+#if defined(TRICE_RING_BUFFER_SIZE) && TRICE_RING_BUFFER_SIZE < 2*(TRICE_SINGLE_MAX_SIZE + 4)
+#error
+#endif
+
+#if defined(TRICE_RING_TRANSFER_SIZE) && TRICE_RING_TRANSFER_SIZE < TRICE_SINGLE_MAX_SIZE
+#error
+#endif
+
+#if defined(TRICE_FLUSH_HIGH_WATER) && defined(TRICE_HALF_BUFFER_SIZE)
+#ifndef TRICE_FLUSH_REQUEST
+#error "TRICE_FLUSH_HIGH_WATER needs a TRICE_FLUSH_REQUEST() hook in triceConfig.h triggering TriceTransfer."
+#endif
+#if TRICE_FLUSH_HIGH_WATER <= TRICE_DATA_OFFSET || TRICE_FLUSH_HIGH_WATER >= TRICE_HALF_BUFFER_SIZE
+#error "TRICE_FLUSH_HIGH_WATER must be a byte offset inside the half buffer."
+#endif
+#define TRICE_FLUSH_CHECK if( TriceBufferWritePosition > TriceFlushLimit ){ TRICE_FLUSH_REQUEST(); } //!< TRICE_FLUSH_CHECK requests a transfer above the high-water mark.
+#else
+#define TRICE_FLUSH_CHECK
+#endif
+
 #ifndef TRICE_TRANSFER_INTERVAL_MS
 //! TRICE_TRANSFER_INTERVAL_MS is the milliseconds interval for TRICE buffer read out.
 //! This time should be shorter than visible delays. The TRICE_HALF_BUFFER_SIZE must be able to hold all trice messages possibly occouring in this time.
 #define TRICE_TRANSFER_INTERVAL_MS 100
 #endif
 
-#if TRICE_CYCLE_COUNTER == 1
+#if TRICE_CYCLE_COUNTER == 1 && defined(TRICE_RING_BUFFER_SIZE)
+#define TRICE_CYCLE 0 //! TRICE_CYCLE is inserted inside TriceRingWrite in reservation order, because TriceCycle++ is not atomic.
+#elif TRICE_CYCLE_COUNTER == 1
 extern uint8_t TriceCycle;
 #define TRICE_CYCLE TriceCycle++ //! TRICE_CYCLE is the trice cycle counter as 8 bit count 0-255.
 #else
@@ -167,11 +393,16 @@ extern uint8_t TriceCycle;
 // UART interface
 //
 
-#if defined( TRICE_UART ) && !defined( TRICE_HALF_BUFFER_SIZE ) // direct out to UART
+#if defined( TRICE_UART ) && !defined( TRICE_DEFERRED_OUT ) // direct out to UART
 void TriceBlockingWrite( uint8_t const * buf, unsigned len );
 #endif
 
-#if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE ) // buffered out to UART
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && defined( TRICE_UART_DMA ) // buffered out to UART with DMA
+void TriceDmaTransmitComplete( void );
+int TriceOutDepth( void );
+#endif
+
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && !defined( TRICE_UART_DMA ) // buffered out to UART
 uint8_t TriceNextUint8( void );
 void triceServeTransmit(void);
 void triceTriggerTransmit(void);
@@ -179,6 +410,41 @@ int TriceOutDepth( void );
 #endif
 
 
+//
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Linux interface
+//
+
+#ifdef TRICE_LINUX
+#ifndef TRICE_RING_BUFFER_SIZE
+#error "TRICE_LINUX needs TRICE_RING_BUFFER_SIZE, so that all threads write lock-free into the ring."
+#endif
+#ifndef TRICE_SHM_SIZE
+#define TRICE_SHM_SIZE 0x100000 //!< TRICE_SHM_SIZE is the data byte count of a "shm:" output ring. Must be a power of 2.
+#endif
+#if (TRICE_SHM_SIZE & (TRICE_SHM_SIZE-1)) || TRICE_SHM_SIZE < 2*(TRICE_DATA_OFFSET + TRICE_RING_TRANSFER_SIZE)
+#error "TRICE_SHM_SIZE must be a power of 2 with space for 2 TriceTransfer writes."
+#endif
+#include <time.h>
+int TriceLinuxOpen( char const* path );
+void TriceLinuxClose( void );
+void TriceLinuxWrite( uint8_t const* buf, unsigned len );
+unsigned TriceLinuxLostBytes( void );
+int TriceOutDepth( void );
+#ifndef TRICE_WRITE
+#define TRICE_WRITE( buf, len ) do{ TriceLinuxWrite( buf, len ); }while(0)
+#endif
+
+//! TriceLinuxMicroseconds returns the monotonic clock in microseconds as wrapping 32-bit value. It is usable as TRICE_TIMESTAMP.
+static inline uint32_t TriceLinuxMicroseconds( void ){
+    struct timespec t;
+    clock_gettime( CLOCK_MONOTONIC, &t );
+    return (uint32_t)t.tv_sec * 1000000u + (uint32_t)(t.tv_nsec / 1000);
+}
+#endif // #ifdef TRICE_LINUX
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -200,8 +466,20 @@ void TriceDecrypt( uint32_t* p, unsigned count );
     0x##b20##b21##b22##b23, \
     0x##b30##b31##b32##b33 }
 
-void TriceInitXteaTable(void);
-    
+#ifdef TRICE_ENCRYPT_CTR
+#ifndef TRICE_KEYSTREAM_BLOCKS
+#define TRICE_KEYSTREAM_BLOCKS 16 //!< TRICE_KEYSTREAM_BLOCKS is the count of precomputed 8-byte keystream blocks. Must be a power of 2.
+#endif
+#if (TRICE_KEYSTREAM_BLOCKS & (TRICE_KEYSTREAM_BLOCKS-1)) != 0
+#error "TRICE_KEYSTREAM_BLOCKS must be a power of 2."
+#endif
+#ifndef TRICE_CTR_NONCE
+#error "TRICE_ENCRYPT_CTR needs TRICE_CTR_NONCE, a value changing with each target reset like a persistent boot counter. Otherwise the keystream repeats after a reset."
+#endif
+void TriceEncryptCTR( uint32_t* p, unsigned count );
+void TriceKeystreamFill( void );
+#endif // #ifdef TRICE_ENCRYPT_CTR
+
 #endif // #ifdef TRICE_ENCRYPT
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -293,10 +571,155 @@ static inline uint64_t aDouble( double x ){
 
 #define TRICE_0  TRICE0  //!< Only the format string without parameter values.
 
+#ifdef TRICE_ID_BITMAP_BITS
+#if TRICE_ID_BITMAP_BITS < 32 || TRICE_ID_BITMAP_BITS > 65536 || (TRICE_ID_BITMAP_BITS & (TRICE_ID_BITMAP_BITS-1))
+#error "TRICE_ID_BITMAP_BITS must be a power of 2 from 32 to 65536."
+#endif
+extern uint32_t triceIdDisabled[TRICE_ID_BITMAP_BITS>>5];
+int TriceIdCommand( char const* cmd );
+//! TRICE_ID_ENABLED is a single load and bit test, because id is a constant Id(n) = n<<16.
+#define TRICE_ID_ENABLED( id ) (!(triceIdDisabled[((id)>>21) & ((TRICE_ID_BITMAP_BITS>>5)-1)] & (1u << (((id)>>16) & 31))))
+#else
+#define TRICE_ID_ENABLED( id ) 1
+#endif
+
+#if defined(TRICE_LEVEL) || defined(TRICE_URGENT_LEVEL)
+#include "til.h" // generated with "trice update -tilh til.h"
+#endif
+
+#ifdef TRICE_LEVEL
+//! TRICE_LEVEL_ENABLED is a compile time constant for a constant id. Trices with a channel level above TRICE_LEVEL generate no code.
+#define TRICE_LEVEL_ENABLED( id ) (triceIdLevel( id ) <= TRICE_LEVEL)
+#else
+#define TRICE_LEVEL_ENABLED( id ) 1
+#endif
+
+#if defined(TRICE_TIL_MAX_SIZE) && TRICE_TIL_MAX_SIZE + TRICE_PREFIX_SIZE > TRICE_SINGLE_MAX_SIZE
+#error "A trice inside til.h is bigger than TRICE_SINGLE_MAX_SIZE."
+#endif
+
+#if defined(TRICE_ID_BITMAP_BITS) || defined(TRICE_LEVEL)
+#define TRICE_ID_CHECK( id ) if( TRICE_LEVEL_ENABLED( id ) && TRICE_ID_ENABLED( id ) ){ //!< TRICE_ID_CHECK skips disabled trices.
+#define TRICE_ID_CHECK_END }
+#else
+#define TRICE_ID_CHECK( id )
+#define TRICE_ID_CHECK_END
+#endif
+
+#ifdef TRICE_RATE_LIMIT_SLOTS
+#if !defined(TRICE_HALF_BUFFER_SIZE) || TRICE_RATE_LIMIT_SLOTS < 1 || TRICE_RATE_LIMIT_SLOTS > 65536 || (TRICE_RATE_LIMIT_SLOTS & (TRICE_RATE_LIMIT_SLOTS-1))
+#error "TRICE_RATE_LIMIT_SLOTS must be a power of 2 up to 65536 and needs TRICE_HALF_BUFFER_SIZE."
+#endif
+#ifndef TRICE_RATE_LIMIT_BURST
+#define TRICE_RATE_LIMIT_BURST 8 //!< TRICE_RATE_LIMIT_BURST is the max count of trices per rate limit slot between two TriceTransfer calls.
+#endif
+#if TRICE_RATE_LIMIT_BURST < 1 || TRICE_RATE_LIMIT_BURST > 255
+#error "TRICE_RATE_LIMIT_BURST must be 1-255."
+#endif
+#if defined(TRICE_FLUSH_HIGH_WATER) && !defined(TRICE_RATE_LIMIT_PERIOD)
+#error "With TRICE_FLUSH_HIGH_WATER a flooding ID triggers the transfers, which would refill its tokens. Define TRICE_RATE_LIMIT_PERIOD."
+#endif
+int TriceRateCheck( uint32_t id );
+#define TRICE_RATE_CHECK( id ) if( TriceRateCheck( id ) ){ //!< TRICE_RATE_CHECK skips flooding trices. It runs inside the critical section.
+#define TRICE_RATE_CHECK_END }
+#else
+#define TRICE_RATE_CHECK( id )
+#define TRICE_RATE_CHECK_END
+#endif
+
+#ifdef TRICE_URGENT_LEVEL
+#ifndef TRICE_URGENT_BUFFER_SIZE
+#error "TRICE_URGENT_LEVEL needs TRICE_URGENT_BUFFER_SIZE."
+#endif
+//! TRICE_URGENT_ID is a compile time constant for a constant id. Trices with a channel level up to TRICE_URGENT_LEVEL go into the urgent buffer.
+#define TRICE_URGENT_ID( id ) (triceIdLevel( id ) != 0 && triceIdLevel( id ) <= TRICE_URGENT_LEVEL)
+#define TRICE_LANE( id ) { int triceUrgentLane = TRICE_URGENT_ID( id ); if( triceUrgentLane ){ TriceUrgentEnter(); } //!< TRICE_LANE selects the buffer by channel.
+#define TRICE_LANE_END if( triceUrgentLane ){ TriceUrgentLeave(); } }
+#else
+#define TRICE_LANE( id )
+#define TRICE_LANE_END
+#endif
+
+#if defined(TRICE_BUFFER_OVERFLOW_PROTECTION) && defined(TRICE_HALF_BUFFER_SIZE)
+#ifndef TRICE_INTO
+#define TRICE_INTO( id ) TRICE_ID_CHECK( id ) TRICE_ENTER TRICE_RATE_CHECK( id ) TRICE_LANE( id ) { uint32_t* triceStart = TriceBufferWritePosition; TRICE_PUT_PREFIX;
+#endif
+#ifndef TRICE_OUTOF
+//! TRICE_OUTOF drops the just written trice, when it ends behind the soft limit.
+#define TRICE_OUTOF if( TriceBufferWritePosition > TriceBufferSoftLimit ){ TriceBufferDrop( triceStart ); } } TRICE_FLUSH_CHECK TRICE_LANE_END TRICE_RATE_CHECK_END TRICE_LEAVE TRICE_ID_CHECK_END
+#endif
+#define TRICE_CONTROL_INTO( id ) TRICE_ENTER TRICE_LANE( id ) { uint32_t* triceStart = TriceBufferWritePosition; TRICE_PUT_PREFIX;
+#define TRICE_CONTROL_OUTOF if( TriceBufferWritePosition > TriceBufferSoftLimit ){ TriceBufferDrop( triceStart ); } } TRICE_FLUSH_CHECK TRICE_LANE_END TRICE_LEAVE
+#endif
+
 #ifndef TRICE_INTO
-#define TRICE_INTO TRICE_ENTER TRICE_PUT_PREFIX;
+#define TRICE_INTO( id ) TRICE_ID_CHECK( id ) TRICE_ENTER TRICE_RATE_CHECK( id ) TRICE_LANE( id ) TRICE_PUT_PREFIX; //!< TRICE_INTO is the start of each TRICE macro.
+#endif
+
+#ifndef TRICE_OUTOF
+#define TRICE_OUTOF TRICE_FLUSH_CHECK TRICE_LANE_END TRICE_RATE_CHECK_END TRICE_LEAVE TRICE_ID_CHECK_END //!< TRICE_OUTOF is the end of each TRICE macro.
 #endif
 
+#ifndef TRICE_CONTROL_INTO
+//! TRICE_CONTROL_INTO and TRICE_CONTROL_OUTOF frame paired control records like span begin and end. They skip the ID filter and the rate limit,
+//! so that these never keep one record of a pair and suppress the other.
+#define TRICE_CONTROL_INTO( id ) TRICE_ENTER TRICE_LANE( id ) TRICE_PUT_PREFIX;
+#define TRICE_CONTROL_OUTOF TRICE_FLUSH_CHECK TRICE_LANE_END TRICE_LEAVE //!< TRICE_CONTROL_OUTOF see TRICE_CONTROL_INTO.
+#endif
+
+//! TRICE_CONTROL_HEAD is the head of a control record. The reserved length byte 0xFF marks it.
+//! The upper 16 bits carry a value, the lowest byte the type in bits 7..2 and the following payload word count in bits 1..0.
+#define TRICE_CONTROL_HEAD( type, value, words ) (((uint32_t)(value)<<16) | 0xFF00 | ((type)<<2) | (words))
+#define TRICE_CONTROL_LOST 1 //!< TRICE_CONTROL_LOST value is the lost trices count and the payload word is the lost bytes count.
+#define TRICE_CONTROL_SUPPRESSED 2 //!< TRICE_CONTROL_SUPPRESSED value is the suppressed trices count and the payload word is the trice ID allowed again.
+#define TRICE_CONTROL_SPAN_BEGIN 3 //!< TRICE_CONTROL_SPAN_BEGIN value is the span ID and the payload word the TRICE_SPAN_CLOCK() value.
+#define TRICE_CONTROL_SPAN_END 4 //!< TRICE_CONTROL_SPAN_END value is the span ID and the payload word the TRICE_SPAN_CLOCK() value.
+#define TRICE_CONTROL_FUNCTION_ENTER 5 //!< TRICE_CONTROL_FUNCTION_ENTER value is the low half of the TRICE_FUNCTION_CLOCK() value and the payload word the function address, a 64-bit address as 2 words with the lower half first.
+#define TRICE_CONTROL_FUNCTION_EXIT 6 //!< TRICE_CONTROL_FUNCTION_EXIT has the same value and payload as TRICE_CONTROL_FUNCTION_ENTER.
+
+#ifndef TRICE_SPAN_CLOCK
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+//! TRICE_SPAN_CLOCK is the DWT cycle counter. It counts only after setting CoreDebug->DEMCR TRCENA and DWT->CTRL CYCCNTENA.
+#define TRICE_SPAN_CLOCK() (*(volatile uint32_t*)0xE0001004UL)
+#elif defined(TRICE_TIMESTAMP)
+#define TRICE_SPAN_CLOCK() (TRICE_TIMESTAMP) //!< TRICE_SPAN_CLOCK is the trice timestamp, when there is no cycle counter.
+#endif
+#endif // #ifndef TRICE_SPAN_CLOCK
+
+#if defined(TRICE_FUNCTION_TRACE) && !defined(TRICE_FUNCTION_CLOCK) && !defined(TRICE_SPAN_CLOCK)
+#error "TRICE_FUNCTION_TRACE needs TRICE_FUNCTION_CLOCK(), TRICE_SPAN_CLOCK() or TRICE_TIMESTAMP."
+#endif
+
+#if defined(TRICE_FUNCTION_TRACE) && !defined(TRICE_FUNCTION_CLOCK)
+//! TRICE_FUNCTION_CLOCK is the clock for the function trace. The trice tool unwraps its lower 16 bits,
+//! so successive function events must be less than 32768 ticks apart. Define a slower clock otherwise.
+#define TRICE_FUNCTION_CLOCK() TRICE_SPAN_CLOCK()
+#endif
+
+#if defined(TRICE_RATE_LIMIT_PERIOD) && !defined(TRICE_SPAN_CLOCK)
+#error "TRICE_RATE_LIMIT_PERIOD needs TRICE_SPAN_CLOCK() or TRICE_TIMESTAMP."
+#endif
+
+#ifndef TRICE_SPAN
+//! TRICE_SPAN writes a span control record with the clock value read before entering the TRICE macro.
+#define TRICE_SPAN( id, type ) do{ \
+    uint32_t triceSpanClock = TRICE_SPAN_CLOCK(); \
+    TRICE_CONTROL_INTO( id ) \
+    TRICE_PUT( TRICE_CONTROL_HEAD( type, (id)>>16, 1 ) ); \
+    TRICE_PUT( triceSpanClock ); \
+    TRICE_CONTROL_OUTOF \
+} while(0)
+#endif // #ifndef TRICE_SPAN
+
+//! TRICE_SPAN_BEGIN and TRICE_SPAN_END mark the start and the end of a code span for "trice spans".
+//! The trice tool pairs them by the name and computes the TRICE_SPAN_CLOCK() difference, so
+//! TRICE_SPAN_BEGIN( Id(0), "adc" ); ... TRICE_SPAN_END( Id(0), "adc" ); get different IDs but make one span.
+//! The span contains the time for writing the begin record. Nested spans with the same name are paired last in first out.
+//! \param id trice identifier
+//! \param name span name (ignored here but used by the trice tool)
+#define TRICE_SPAN_BEGIN( id, name ) TRICE_SPAN( id, TRICE_CONTROL_SPAN_BEGIN )
+#define TRICE_SPAN_END( id, name ) TRICE_SPAN( id, TRICE_CONTROL_SPAN_END ) //!< TRICE_SPAN_END see TRICE_SPAN_BEGIN.
+
 #ifndef TRICE_N
 //! TRICE_N writes id and buffer of size len.
 //! \param id trice identifier
@@ -309,6 +732,7 @@ static inline uint64_t aDouble( double x ){
 //! c0     c1     c2     c3    <- buffer
 //! ...                        <- buffer
 //! cLen-3 cLen-2 cLen-1 cLen  <- buffer ending with maybe 1-3 undetermined padding bytes
+//! A buffer bigger than TRICE_SINGLE_MAX_SIZE allows is truncated or, with TRICE_FRAGMENTS, streamed by TriceFragments.
 //
 // todo: for some reason this macro is not working well wit name len instead of len_, probably when injected len as value.
 //
@@ -316,16 +740,17 @@ static inline uint64_t aDouble( double x ){
     uint32_t limit = TRICE_SINGLE_MAX_SIZE-TRICE_PREFIX_SIZE-8; /* 8 = head + len size */ \
     uint32_t len_ = n; /* n could be a constant */ \
     if( len_ > limit ){ \
+        TRICE_N_FRAGMENTS( id, buf, len_ ) \
         TRICE32( Id(61732), "wrn:Transmit buffer truncated from %u to %u\n", len_, limit ); \
         len_ = limit; \
     } \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | (0xff00 & ((len_+7)<<6)) | TRICE_CYCLE ); /* +3 for padding, +4 for the buf size value transmitted in the payload to get the last 2 bits. */ \
     TRICE_PUT( len_ ); /* len as byte does not contain the exact buf len anymore, so transmit it to the host */ \
     /* len is needed for non string buffers because the last 2 bits not stored in head. */ \
     /* All trices know the data length but not TRICE8P. len byte values 0xFC, xFD, xFE, xFF are reserved for future extensions. */ \
     TRICE_PUTBUFFER( buf, len_ ); \
-    TRICE_LEAVE \
+    TRICE_OUTOF \
 } while(0)
 #endif // #ifndef TRICE_N
 
@@ -345,9 +770,9 @@ static inline uint64_t aDouble( double x ){
 //! TRICE0 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define TRICE0( id, pFmt ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0000 | TRICE_CYCLE ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 #define TRICE_BYTE0(v)((uint8_t)(v))
 #define TRICE_BYTE1(v)(0x0000FF00 &  ((uint32_t)(v)<< 8))
@@ -358,237 +783,237 @@ static inline uint64_t aDouble( double x ){
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 a 8 bit bit value
 #define TRICE8_1( id, pFmt, v0 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT(                                                   TRICE_BYTE0(v0)); /* little endian*/ \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_2 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v1 are 8 bit bit values
 #define TRICE8_2( id, pFmt, v0, v1 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT(                                  TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_3 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v2 are 8 bit bit values
 #define TRICE8_3( id, pFmt, v0, v1, v2 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT(                  TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_4 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v3 are 8 bit bit values
 #define TRICE8_4( id, pFmt, v0, v1, v2, v3 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_5 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v4 are 8 bit bit values
 #define TRICE8_5( id, pFmt, v0, v1, v2, v3, v4 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT(                                                    TRICE_BYTE0(v4)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_6 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v5 are 8 bit bit values
 #define TRICE8_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT(                                   TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v6 are 8 bit bit values
 #define TRICE8_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT(                  TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 8 bit bit values
 #define TRICE8_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT( TRICE_BYTE3(v7) |TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 8 bit bit values
 #define TRICE8_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT( TRICE_BYTE3(v7) |TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
     TRICE_PUT(                                                    TRICE_BYTE0(v8)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 8 bit bit values
 #define TRICE8_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT( TRICE_BYTE3(v7) |TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
     TRICE_PUT(                                   TRICE_BYTE1(v9) |TRICE_BYTE0(v8)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 8 bit bit values
 #define TRICE8_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT( TRICE_BYTE3(v7) |TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
     TRICE_PUT(                  TRICE_BYTE2(v10)|TRICE_BYTE1(v9) |TRICE_BYTE0(v8)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE8_12 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v11 are 8 bit bit values
 #define TRICE8_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT( TRICE_BYTE3(v3) |TRICE_BYTE2(v2) |TRICE_BYTE1(v1) |TRICE_BYTE0(v0)); \
     TRICE_PUT( TRICE_BYTE3(v7) |TRICE_BYTE2(v6) |TRICE_BYTE1(v5) |TRICE_BYTE0(v4)); \
     TRICE_PUT( TRICE_BYTE3(v11)|TRICE_BYTE2(v10)|TRICE_BYTE1(v9) |TRICE_BYTE0(v8)); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_1 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 a 16 bit value
 #define TRICE16_1( id, pFmt, v0 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT( (uint16_t)(v0) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_2 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v1 are 16 bit values
 #define TRICE16_2( id, pFmt, v0, v1 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_3 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v2 are 16 bit values
 #define TRICE16_3( id, pFmt, v0, v1, v2 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT( (uint16_t)(v2) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_4 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v3 are 16 bit values
 #define TRICE16_4( id, pFmt, v0, v1, v2, v3 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_5 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v4 are 16 bit values
 #define TRICE16_5( id, pFmt, v0, v1, v2, v3, v4 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_6 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v5 are 16 bit values
 #define TRICE16_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) | ((uint32_t)(v5)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_7 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v6 are 16 bit values
 #define TRICE16_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0400 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) | ((uint32_t)(v5)<<16) ); \
     TRICE_PUT((uint16_t)(v6) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 16 bit values
 #define TRICE16_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0400 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) | ((uint32_t)(v5)<<16) ); \
     TRICE_PUT((uint16_t)(v6) | ((uint32_t)(v7)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
     
 //! TRICE16_9 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v8 are 16 bit values
 #define TRICE16_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0500 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) | ((uint32_t)(v5)<<16) ); \
     TRICE_PUT((uint16_t)(v6) | ((uint32_t)(v7)<<16) ); \
     TRICE_PUT((uint16_t)(v8) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE16_10 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v9 are 16 bit values
 #define TRICE16_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0500 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
     TRICE_PUT((uint16_t)(v4) | ((uint32_t)(v5)<<16) ); \
     TRICE_PUT((uint16_t)(v6) | ((uint32_t)(v7)<<16) ); \
     TRICE_PUT((uint16_t)(v8) | ((uint32_t)(v9)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
     
 //! TRICE16_11 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v10 are 16 bit values
 #define TRICE16_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0600 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
@@ -596,13 +1021,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT((uint16_t)(v6) | ((uint32_t)(v7)<<16) ); \
     TRICE_PUT((uint16_t)(v8) | ((uint32_t)(v9)<<16) ); \
     TRICE_PUT((uint16_t)(v10) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
     
 //! TRICE16_12 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v11 are 16 bit values
 #define TRICE16_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0600 | TRICE_CYCLE ); \
     TRICE_PUT((uint16_t)(v0) | ((uint32_t)(v1)<<16) ); \
     TRICE_PUT((uint16_t)(v2) | ((uint32_t)(v3)<<16) ); \
@@ -610,68 +1035,68 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT((uint16_t)(v6) | ((uint32_t)(v7)<<16) ); \
     TRICE_PUT((uint16_t)(v8) | ((uint32_t)(v9)<<16) ); \
     TRICE_PUT((uint16_t)(v10)| ((uint32_t)(v11)<<16) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_1 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 the 32 bit value
 #define TRICE32_1( id, pFmt, v0 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0100 | TRICE_CYCLE); \
     TRICE_PUT( (uint32_t)(v0) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_2 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v1 are 32 bit values
 #define TRICE32_2( id, pFmt, v0, v1 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT(id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_3 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v2 are 32 bit values
 #define TRICE32_3( id, pFmt, v0, v1, v2 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0300 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
     TRICE_PUT( (uint32_t)(v2) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_4 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v3 are 32 bit values
 #define TRICE32_4( id, pFmt, v0, v1, v2, v3 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0400 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
     TRICE_PUT( (uint32_t)(v2) ); \
     TRICE_PUT( (uint32_t)(v3) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_5 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v4 are 32 bit values
 #define TRICE32_5( id, pFmt,  v0, v1, v2, v3, v4 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0500 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
     TRICE_PUT( (uint32_t)(v2) ); \
     TRICE_PUT( (uint32_t)(v3) ); \
     TRICE_PUT( (uint32_t)(v4) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_6 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v5 are 32 bit values
 #define TRICE32_6( id, pFmt,  v0, v1, v2, v3, v4, v5 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0600 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -679,13 +1104,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v3) ); \
     TRICE_PUT( (uint32_t)(v4) ); \
     TRICE_PUT( (uint32_t)(v5) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_7 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v6 are 32 bit values
 #define TRICE32_7( id, pFmt,  v0, v1, v2, v3, v4, v5, v6 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0700 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -694,13 +1119,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v4) ); \
     TRICE_PUT( (uint32_t)(v5) ); \
     TRICE_PUT( (uint32_t)(v6) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 32 bit values
 #define TRICE32_8( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0800 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -710,13 +1135,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v5) ); \
     TRICE_PUT( (uint32_t)(v6) ); \
     TRICE_PUT( (uint32_t)(v7) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_9 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v8 are 32 bit values
 #define TRICE32_9( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0900 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -727,13 +1152,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v6) ); \
     TRICE_PUT( (uint32_t)(v7) ); \
     TRICE_PUT( (uint32_t)(v8) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_10 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - 9 are 32 bit values
 #define TRICE32_10( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0a00 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -745,13 +1170,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v7) ); \
     TRICE_PUT( (uint32_t)(v8) ); \
     TRICE_PUT( (uint32_t)(v9) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_11 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v10 are 32 bit values
 #define TRICE32_11( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0b00 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -764,13 +1189,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v8) ); \
     TRICE_PUT( (uint32_t)(v9) ); \
     TRICE_PUT( (uint32_t)(v10) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE32_12 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v11 are 32 bit values
 #define TRICE32_12( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0c00 | TRICE_CYCLE ); \
     TRICE_PUT( (uint32_t)(v0) ); \
     TRICE_PUT( (uint32_t)(v1) ); \
@@ -784,69 +1209,69 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT( (uint32_t)(v9) ); \
     TRICE_PUT( (uint32_t)(v10) ); \
     TRICE_PUT( (uint32_t)(v11) ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_1 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 is a 64 bit values
 #define TRICE64_1( id, pFmt, v0 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0200 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_2 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v1 are 64 bit values
 #define TRICE64_2( id, pFmt, v0, v1 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0400 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_3 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v2 are 64 bit values
 #define TRICE64_3( id, pFmt, v0, v1, v2 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0600 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
     TRICE_PUT64( v2 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 
 //! TRICE64_4 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v3 are 64 bit values
 #define TRICE64_4( id, pFmt, v0, v1, v2, v3 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0800 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
     TRICE_PUT64( v2 ); \
     TRICE_PUT64( v3 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_5 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v4 are 64 bit values
 #define TRICE64_5( id, pFmt,  v0, v1, v2, v3, v4 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0a00 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
     TRICE_PUT64( v2 ); \
     TRICE_PUT64( v3 ); \
     TRICE_PUT64( v4 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_6 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v5 are 64 bit values
 #define TRICE64_6( id, pFmt,  v0, v1, v2, v3, v4, v5 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0c00 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -854,13 +1279,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v3 ); \
     TRICE_PUT64( v4 ); \
     TRICE_PUT64( v5 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_7 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v6 are 64 bit values
 #define TRICE64_7( id, pFmt,  v0, v1, v2, v3, v4, v5, v6 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x0e00 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -869,13 +1294,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v4 ); \
     TRICE_PUT64( v5 ); \
     TRICE_PUT64( v6 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
     
 //! TRICE64_8 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v7 are 64 bit values
 #define TRICE64_8( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x1000 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -885,13 +1310,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v5 ); \
     TRICE_PUT64( v6 ); \
     TRICE_PUT64( v7 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_9 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v8 are 64 bit values
 #define TRICE64_9( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x1200 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -902,13 +1327,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v6 ); \
     TRICE_PUT64( v7 ); \
     TRICE_PUT64( v8 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_10 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v9 are 64 bit values
 #define TRICE64_10( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x1400 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -920,13 +1345,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v7 ); \
     TRICE_PUT64( v8 ); \
     TRICE_PUT64( v9 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_11 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v10 are 64 bit values
 #define TRICE64_11( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x1600 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -939,13 +1364,13 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v8 ); \
     TRICE_PUT64( v9 ); \
     TRICE_PUT64( v10 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
 
 //! TRICE64_12 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 //! \param v0 - v11 are 64 bit values
 #define TRICE64_12( id, pFmt,  v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
-    TRICE_INTO \
+    TRICE_INTO( id ) \
     TRICE_PUT( id | 0x1800 | TRICE_CYCLE ); \
     TRICE_PUT64( v0 ); \
     TRICE_PUT64( v1 ); \
@@ -959,7 +1384,186 @@ static inline uint64_t aDouble( double x ){
     TRICE_PUT64( v9 ); \
     TRICE_PUT64( v10 ); \
     TRICE_PUT64( v11 ); \
-    TRICE_LEAVE
+    TRICE_OUTOF
+
+#ifdef TRICE_FUNCTIONS
+//! With TRICE_FUNCTIONS the TRICE macros call these functions instead of expanding inline. That saves flash and I-cache for many trices.
+//! The TriceCallX_n functions only collect their values for TriceCallXn, so the TRICE macro code exists only once in TriceCall32n.
+//! The level check and the urgent buffer selection stay at the call site, where the id is a compile time constant.
+//! With TRICE_LOCATION the call site passes its location as first parameter, otherwise all trices would report their location inside trice.c.
+#ifdef TRICE_LOCATION
+#define TRICE_CALL_LOCATION_PARAM uint32_t location, //!< TRICE_CALL_LOCATION_PARAM is the location parameter of the TriceCall functions.
+#define TRICE_CALL_LOCATION TRICE_LOCATION, //!< TRICE_CALL_LOCATION is the location argument, evaluated at the call site.
+#else
+#define TRICE_CALL_LOCATION_PARAM
+#define TRICE_CALL_LOCATION
+#endif
+void TriceCall8n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v );
+void TriceCall16n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v );
+void TriceCall32n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint32_t const* v );
+void TriceCall64n( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t count, uint64_t const* v );
+void TriceCall0( TRICE_CALL_LOCATION_PARAM uint32_t id );
+void TriceCall8_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 );
+void TriceCall8_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 );
+void TriceCall8_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 );
+void TriceCall8_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 );
+void TriceCall8_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 );
+void TriceCall8_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 );
+void TriceCall8_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 );
+void TriceCall8_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 );
+void TriceCall8_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 );
+void TriceCall8_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 );
+void TriceCall8_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 );
+void TriceCall8_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 );
+void TriceCall16_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 );
+void TriceCall16_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 );
+void TriceCall16_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 );
+void TriceCall16_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 );
+void TriceCall16_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 );
+void TriceCall16_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 );
+void TriceCall16_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 );
+void TriceCall16_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 );
+void TriceCall16_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 );
+void TriceCall16_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 );
+void TriceCall16_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 );
+void TriceCall16_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 );
+void TriceCall32_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0 );
+void TriceCall32_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1 );
+void TriceCall32_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2 );
+void TriceCall32_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 );
+void TriceCall32_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 );
+void TriceCall32_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 );
+void TriceCall32_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 );
+void TriceCall32_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 );
+void TriceCall32_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 );
+void TriceCall32_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 );
+void TriceCall32_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 );
+void TriceCall32_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 );
+void TriceCall64_1( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0 );
+void TriceCall64_2( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1 );
+void TriceCall64_3( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2 );
+void TriceCall64_4( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3 );
+void TriceCall64_5( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4 );
+void TriceCall64_6( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5 );
+void TriceCall64_7( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6 );
+void TriceCall64_8( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7 );
+void TriceCall64_9( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8 );
+void TriceCall64_10( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9 );
+void TriceCall64_11( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10 );
+void TriceCall64_12( TRICE_CALL_LOCATION_PARAM uint32_t id, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11 );
+void TriceCallN( TRICE_CALL_LOCATION_PARAM uint32_t id, void const* buf, uint32_t len );
+
+#if !defined(TRICE_IMPLEMENTATION) && !defined(TRICE_OFF) // trice.c uses the inline macros for the function bodies
+#ifdef TRICE_URGENT_LEVEL
+#define TRICE_CALL_URGENT( id ) TRICE_URGENT_ID( id )
+#else
+#define TRICE_CALL_URGENT( id ) 0
+#endif
+//! TRICE_CALL executes call, if the trice level is enabled, and selects the urgent buffer for urgent ids.
+#define TRICE_CALL( id, call ) if( TRICE_LEVEL_ENABLED( id ) ){ if( TRICE_CALL_URGENT( id ) ){ TRICE_URGENT( call ); }else{ call; } }
+
+#undef TRICE0
+#define TRICE0( id, pFmt ) TRICE_CALL( id, TriceCall0( TRICE_CALL_LOCATION id ) )
+#undef TRICE8_1
+#define TRICE8_1( id, pFmt, v0 ) TRICE_CALL( id, TriceCall8_1( TRICE_CALL_LOCATION id, v0 ) )
+#undef TRICE8_2
+#define TRICE8_2( id, pFmt, v0, v1 ) TRICE_CALL( id, TriceCall8_2( TRICE_CALL_LOCATION id, v0, v1 ) )
+#undef TRICE8_3
+#define TRICE8_3( id, pFmt, v0, v1, v2 ) TRICE_CALL( id, TriceCall8_3( TRICE_CALL_LOCATION id, v0, v1, v2 ) )
+#undef TRICE8_4
+#define TRICE8_4( id, pFmt, v0, v1, v2, v3 ) TRICE_CALL( id, TriceCall8_4( TRICE_CALL_LOCATION id, v0, v1, v2, v3 ) )
+#undef TRICE8_5
+#define TRICE8_5( id, pFmt, v0, v1, v2, v3, v4 ) TRICE_CALL( id, TriceCall8_5( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4 ) )
+#undef TRICE8_6
+#define TRICE8_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) TRICE_CALL( id, TriceCall8_6( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5 ) )
+#undef TRICE8_7
+#define TRICE8_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) TRICE_CALL( id, TriceCall8_7( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6 ) )
+#undef TRICE8_8
+#define TRICE8_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) TRICE_CALL( id, TriceCall8_8( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7 ) )
+#undef TRICE8_9
+#define TRICE8_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) TRICE_CALL( id, TriceCall8_9( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) )
+#undef TRICE8_10
+#define TRICE8_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) TRICE_CALL( id, TriceCall8_10( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) )
+#undef TRICE8_11
+#define TRICE8_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) TRICE_CALL( id, TriceCall8_11( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) )
+#undef TRICE8_12
+#define TRICE8_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) TRICE_CALL( id, TriceCall8_12( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) )
+#undef TRICE16_1
+#define TRICE16_1( id, pFmt, v0 ) TRICE_CALL( id, TriceCall16_1( TRICE_CALL_LOCATION id, v0 ) )
+#undef TRICE16_2
+#define TRICE16_2( id, pFmt, v0, v1 ) TRICE_CALL( id, TriceCall16_2( TRICE_CALL_LOCATION id, v0, v1 ) )
+#undef TRICE16_3
+#define TRICE16_3( id, pFmt, v0, v1, v2 ) TRICE_CALL( id, TriceCall16_3( TRICE_CALL_LOCATION id, v0, v1, v2 ) )
+#undef TRICE16_4
+#define TRICE16_4( id, pFmt, v0, v1, v2, v3 ) TRICE_CALL( id, TriceCall16_4( TRICE_CALL_LOCATION id, v0, v1, v2, v3 ) )
+#undef TRICE16_5
+#define TRICE16_5( id, pFmt, v0, v1, v2, v3, v4 ) TRICE_CALL( id, TriceCall16_5( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4 ) )
+#undef TRICE16_6
+#define TRICE16_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) TRICE_CALL( id, TriceCall16_6( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5 ) )
+#undef TRICE16_7
+#define TRICE16_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) TRICE_CALL( id, TriceCall16_7( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6 ) )
+#undef TRICE16_8
+#define TRICE16_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) TRICE_CALL( id, TriceCall16_8( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7 ) )
+#undef TRICE16_9
+#define TRICE16_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) TRICE_CALL( id, TriceCall16_9( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) )
+#undef TRICE16_10
+#define TRICE16_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) TRICE_CALL( id, TriceCall16_10( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) )
+#undef TRICE16_11
+#define TRICE16_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) TRICE_CALL( id, TriceCall16_11( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) )
+#undef TRICE16_12
+#define TRICE16_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) TRICE_CALL( id, TriceCall16_12( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) )
+#undef TRICE32_1
+#define TRICE32_1( id, pFmt, v0 ) TRICE_CALL( id, TriceCall32_1( TRICE_CALL_LOCATION id, v0 ) )
+#undef TRICE32_2
+#define TRICE32_2( id, pFmt, v0, v1 ) TRICE_CALL( id, TriceCall32_2( TRICE_CALL_LOCATION id, v0, v1 ) )
+#undef TRICE32_3
+#define TRICE32_3( id, pFmt, v0, v1, v2 ) TRICE_CALL( id, TriceCall32_3( TRICE_CALL_LOCATION id, v0, v1, v2 ) )
+#undef TRICE32_4
+#define TRICE32_4( id, pFmt, v0, v1, v2, v3 ) TRICE_CALL( id, TriceCall32_4( TRICE_CALL_LOCATION id, v0, v1, v2, v3 ) )
+#undef TRICE32_5
+#define TRICE32_5( id, pFmt, v0, v1, v2, v3, v4 ) TRICE_CALL( id, TriceCall32_5( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4 ) )
+#undef TRICE32_6
+#define TRICE32_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) TRICE_CALL( id, TriceCall32_6( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5 ) )
+#undef TRICE32_7
+#define TRICE32_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) TRICE_CALL( id, TriceCall32_7( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6 ) )
+#undef TRICE32_8
+#define TRICE32_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) TRICE_CALL( id, TriceCall32_8( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7 ) )
+#undef TRICE32_9
+#define TRICE32_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) TRICE_CALL( id, TriceCall32_9( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) )
+#undef TRICE32_10
+#define TRICE32_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) TRICE_CALL( id, TriceCall32_10( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) )
+#undef TRICE32_11
+#define TRICE32_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) TRICE_CALL( id, TriceCall32_11( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) )
+#undef TRICE32_12
+#define TRICE32_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) TRICE_CALL( id, TriceCall32_12( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) )
+#undef TRICE64_1
+#define TRICE64_1( id, pFmt, v0 ) TRICE_CALL( id, TriceCall64_1( TRICE_CALL_LOCATION id, v0 ) )
+#undef TRICE64_2
+#define TRICE64_2( id, pFmt, v0, v1 ) TRICE_CALL( id, TriceCall64_2( TRICE_CALL_LOCATION id, v0, v1 ) )
+#undef TRICE64_3
+#define TRICE64_3( id, pFmt, v0, v1, v2 ) TRICE_CALL( id, TriceCall64_3( TRICE_CALL_LOCATION id, v0, v1, v2 ) )
+#undef TRICE64_4
+#define TRICE64_4( id, pFmt, v0, v1, v2, v3 ) TRICE_CALL( id, TriceCall64_4( TRICE_CALL_LOCATION id, v0, v1, v2, v3 ) )
+#undef TRICE64_5
+#define TRICE64_5( id, pFmt, v0, v1, v2, v3, v4 ) TRICE_CALL( id, TriceCall64_5( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4 ) )
+#undef TRICE64_6
+#define TRICE64_6( id, pFmt, v0, v1, v2, v3, v4, v5 ) TRICE_CALL( id, TriceCall64_6( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5 ) )
+#undef TRICE64_7
+#define TRICE64_7( id, pFmt, v0, v1, v2, v3, v4, v5, v6 ) TRICE_CALL( id, TriceCall64_7( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6 ) )
+#undef TRICE64_8
+#define TRICE64_8( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7 ) TRICE_CALL( id, TriceCall64_8( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7 ) )
+#undef TRICE64_9
+#define TRICE64_9( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) TRICE_CALL( id, TriceCall64_9( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) )
+#undef TRICE64_10
+#define TRICE64_10( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) TRICE_CALL( id, TriceCall64_10( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) )
+#undef TRICE64_11
+#define TRICE64_11( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) TRICE_CALL( id, TriceCall64_11( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) )
+#undef TRICE64_12
+#define TRICE64_12( id, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) TRICE_CALL( id, TriceCall64_12( TRICE_CALL_LOCATION id, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) )
+#undef TRICE_N
+#define TRICE_N( id, pFmt, buf, n ) TRICE_CALL( id, TriceCallN( TRICE_CALL_LOCATION id, buf, n ) )
+#endif
+#endif // #ifdef TRICE_FUNCTIONS
 
 #ifdef __cplusplus
 }
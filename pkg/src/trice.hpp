@@ -0,0 +1,74 @@
+/*! \file trice.hpp
+\brief TRICE_M for C++ with parameter bit widths deduced at compile time
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_HPP_
+#define TRICE_HPP_
+
+#include "trice.h"
+#include <type_traits>
+
+#ifdef TRICE_OFF
+
+//! TRICE_M generates no code with TRICE_OFF.
+template<typename... T> inline void TRICE_M( uint32_t, char const*, T... ){}
+
+#else // #ifdef TRICE_OFF
+
+//! TriceWidth is the byte count and the width code of a TRICE_M parameter of type T.
+//! The width code is 0 for 8, 1 for 16, 2 for 32 and 3 for 64 bit.
+template<typename T> struct TriceWidth {
+    static_assert( std::is_scalar<T>::value, "TRICE_M parameters must be numbers, enums, bools or pointers." );
+    static_assert( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "TRICE_M parameters must be 8, 16, 32 or 64 bit wide." );
+    static constexpr uint32_t bytes = sizeof(T);
+    static constexpr uint32_t code = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+};
+
+//! TriceMixed sums the parameter byte counts and collects the width codes of all parameters, 2 bits each.
+template<typename... T> struct TriceMixed;
+
+template<> struct TriceMixed<> {
+    static constexpr uint32_t bytes = 0;
+    static constexpr uint32_t codes = 0;
+};
+
+template<typename T, typename... R> struct TriceMixed<T, R...> {
+    static constexpr uint32_t bytes = TriceWidth<T>::bytes + TriceMixed<R...>::bytes;
+    static constexpr uint32_t codes = TriceWidth<T>::code | TriceMixed<R...>::codes << 2;
+};
+
+//! tricePack copies the parameters without padding to p.
+inline void tricePack( uint8_t* ){}
+
+template<typename T, typename... R> inline void tricePack( uint8_t* p, T v, R... r ){
+    memcpy( p, &v, sizeof(T) );
+    tricePack( p + sizeof(T), r... );
+}
+
+//! TRICE_M writes id and up to 12 parameters, each with its own bit width.
+//! The payload starts with a width descriptor word: parameter count in bits 31..24 and 2 bits for each parameter starting with bits 1..0.
+//! The parameters follow packed without padding, only the payload end is aligned to 4 bytes.
+//! All sizes are compile time constants. The trice tool reads the descriptor, so floats need no aFloat() and a
+//! TRICE_M( Id(0), "msg:%d %u %f %f\n", i8, u32, f, d ) with an int8_t, uint32_t, float and double is fine.
+//! \param id trice identifier
+//! \param pFmt formatstring for trice (ignored here but used by the trice tool)
+//! \param v are the parameters
+template<typename... T> inline void TRICE_M( uint32_t id, char const* pFmt, T... v ){
+    static_assert( sizeof...(T) <= 12, "TRICE_M supports up to 12 parameters." );
+    constexpr uint32_t words = (4 + TriceMixed<T...>::bytes + 3) >> 2; // width descriptor plus parameters
+    static_assert( 4 + 4*words <= TRICE_SINGLE_MAX_SIZE - TRICE_PREFIX_SIZE, "TRICE_M parameters exceed TRICE_SINGLE_MAX_SIZE." );
+    uint32_t payload[words] = { (uint32_t)sizeof...(T) << 24 | TriceMixed<T...>::codes };
+    tricePack( (uint8_t*)(payload + 1), v... );
+    (void)pFmt;
+    TRICE_INTO( id )
+    TRICE_PUT( id | words << 8 | TRICE_CYCLE );
+    for( uint32_t i = 0; i < words; i++ ){
+        TRICE_PUT( payload[i] );
+    }
+    TRICE_OUTOF
+}
+
+#endif // #else // #ifdef TRICE_OFF
+
+#endif // TRICE_HPP_
@@ -20,7 +20,7 @@ int64_t DoubleToInt64( double f ){
     }
     return -(int64_t)-f;
 }
-/*
+
 #include "tcobs.h"
 
 typedef struct{
@@ -56,8 +56,8 @@ int equal( uint8_t* expBuf, int expLen, uint8_t* actBuf, int actLen ){
         return 0;
     }
     for( int i = 0; i < expLen; i++ ){
-        TRICE( Id(45332), "msg:exp=%02x act=%02x\n", expBuf[i], actBuf[i] );
         if( expBuf[i] != actBuf[i] ){
+            TRICE( Id(45332), "msg:exp=%02x act=%02x\n", expBuf[i], actBuf[i] );
             return 0;
         }
     }
@@ -74,7 +74,6 @@ void TCOBSCheck( void ){
         }
     }
 }
-*/
 
 //! TriceCheckSet writes out all types of trices with fixed values for testing
 //! \details One trice has one subtrace, if param size max 2 bytes. 
@@ -151,7 +150,7 @@ void TriceCheckSet(int index) {
             TRICE( Id(38453), "dbg:\a\aHi!\n" );
             TRICE( Id(45474), "dbg:\a\a\aHi!\n" );
             TRICE( Id(58434), "dbg:\\aHi!\n" );
-            //TCOBSCheck();
+            TCOBSCheck();
         break;
         case 40:
             s = "AAAAAAAAAAAA";
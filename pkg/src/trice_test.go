@@ -1,11 +1,14 @@
 package src
 
 import (
+	"encoding/binary"
 	"fmt"
 	"io"
+	"math/rand"
 	"os"
 	"testing"
 
+	"github.com/rokath/trice/pkg/tcobs"
 	"github.com/tj/assert"
 )
 
@@ -49,3 +52,80 @@ var triceBytes = [][]byte{
 	[]byte{0x02, 0x03, 0x01, 0x01, 0x02, 0x16, 0x0c, 0x38, 0xcb, 0x11, 0x11, 0x11, 0x11, 0xc0, 0x04, 0xd7, 0xcb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
 	[]byte{0x02, 0x03, 0x01, 0x01, 0x02, 0x17, 0x0c, 0x38, 0xcb, 0x11, 0x11, 0x11, 0x11, 0xc0, 0x04, 0x84, 0xa8, 0x0c, 0x01, 0x01, 0x0d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00},
 }
+
+// TestTriceCOBSEncode32 checks TriceCOBSEncode32 against TriceCOBSEncode with random data of different zero densities.
+func TestTriceCOBSEncode32(t *testing.T) {
+	r := rand.New(rand.NewSource(1))
+	exp := make([]byte, 2048)
+	act := make([]byte, 2048)
+	for _, zeroPercent := range []int{0, 1, 10, 50, 100} {
+		for length := 1; length < 1500; length += 1 + r.Intn(13) {
+			in := make([]byte, length)
+			for k := range in {
+				if r.Intn(100) >= zeroPercent {
+					in[k] = byte(1 + r.Intn(255))
+				}
+			}
+			e := triceCOBSEncode(exp, in)
+			a := triceCOBSEncode32(act, in)
+			assert.Equal(t, exp[:e], act[:a])
+		}
+	}
+}
+
+// triceCOBSBenchmarkData returns a package of n bytes similar to typical trice data:
+// descriptor, timestamp, head and small 32-bit values containing zeroes.
+func triceCOBSBenchmarkData(n int) []byte {
+	b := make([]byte, n)
+	for i := 0; i+16 <= n; i += 16 {
+		binary.LittleEndian.PutUint32(b[i:], 0x11223344+uint32(i))       // timestamp
+		binary.LittleEndian.PutUint32(b[i+4:], 0xcb380100|uint32(i&255)) // head
+		binary.LittleEndian.PutUint32(b[i+8:], uint32(i))                // value
+		binary.LittleEndian.PutUint32(b[i+12:], 0xffffffff-uint32(i))    // value
+	}
+	return b
+}
+
+func benchmarkTriceCOBSEncode(b *testing.B, encode func(o, i []byte) int, n int) {
+	in := triceCOBSBenchmarkData(n)
+	out := make([]byte, n+n/254+16)
+	b.SetBytes(int64(n))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		encode(out, in)
+	}
+}
+
+// The benchmarks include the cgo call overhead, so compare them for the bigger packages.
+// Cycles per byte are roughly the CPU clock in MHz divided by the MB/s values.
+
+func BenchmarkTriceCOBSEncode64(b *testing.B)    { benchmarkTriceCOBSEncode(b, triceCOBSEncode, 64) }
+func BenchmarkTriceCOBSEncode1k(b *testing.B)    { benchmarkTriceCOBSEncode(b, triceCOBSEncode, 1024) }
+func BenchmarkTriceCOBSEncode32_64(b *testing.B) { benchmarkTriceCOBSEncode(b, triceCOBSEncode32, 64) }
+func BenchmarkTriceCOBSEncode32_1k(b *testing.B) {
+	benchmarkTriceCOBSEncode(b, triceCOBSEncode32, 1024)
+}
+
+// TestTCOBSEncode checks the C TCOBSEncode against the Go tcobs package with random data containing runs.
+func TestTCOBSEncode(t *testing.T) {
+	r := rand.New(rand.NewSource(2))
+	exp := make([]byte, 2048)
+	act := make([]byte, 2048)
+	dec := make([]byte, 2048)
+	for k := 0; k < 1000; k++ {
+		size := 1 + r.Intn(1000)
+		in := make([]byte, 0, size+12)
+		for len(in) < size {
+			b := []byte{0, 0xFF, 0x55, byte(r.Intn(256))}[r.Intn(4)]
+			for c := r.Intn(12); c >= 0; c-- {
+				in = append(in, b)
+			}
+		}
+		e := tcobs.Encode(exp, in)
+		a := tcobsEncode(act, in)
+		assert.Equal(t, exp[:e], act[:a])
+		n, err := tcobs.Decode(dec, act[:a])
+		assert.Nil(t, err)
+		assert.Equal(t, in, dec[:n])
+	}
+}
@@ -0,0 +1,47 @@
+// Package tricetest holds the helpers shared by the host tests of the target C-code in the pkg/src sub-directories.
+// Each test package compiles trice.c with its own triceConfig.h and the TRICE_WRITE mock inc/triceWriteMock.c.
+package tricetest
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/rokath/trice/pkg/cobs"
+	"github.com/tj/assert"
+)
+
+// Packages returns the decoded COBS packages inside the 0 delimited byte stream b.
+func Packages(t *testing.T, b []byte) (r [][]byte) {
+	for _, pkg := range bytes.Split(b, []byte{0}) {
+		if len(pkg) == 0 {
+			continue
+		}
+		d := make([]byte, len(pkg))
+		n, e := cobs.Decode(d, pkg)
+		assert.Nil(t, e)
+		r = append(r, d[:n])
+	}
+	return
+}
+
+// Package returns the first decoded COBS package inside b or nil, if there is none.
+func Package(t *testing.T, b []byte) []byte {
+	p := Packages(t, b)
+	if len(p) == 0 {
+		return nil
+	}
+	return p[0]
+}
+
+// IDs returns the trice IDs inside the first COBS package in b. The trices must not have timestamps or locations.
+func IDs(t *testing.T, b []byte) (r []int) {
+	d := Package(t, b)
+	if len(d) < 4 {
+		return
+	}
+	for d = d[4:]; len(d) >= 4; { // skip descriptor
+		r = append(r, int(d[3])<<8|int(d[2]))
+		d = d[4+4*int(d[1]):]
+	}
+	return
+}
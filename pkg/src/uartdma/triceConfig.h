@@ -0,0 +1,44 @@
+/*! \file triceConfig.h
+\brief trice configuration for the UART DMA host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_MODE 200 //! TRICE_MODE is a predefined trice transfer method.
+
+#define TRICE_UART 1   //!< No real UART, only the DMA hooks are used.
+#define TRICE_UART_DMA //!< Transmit with DMA. triceStartDmaTransmit is mocked in uartdma.c.
+
+#define TRICE_ENTER //! TRICE_ENTER is the start of TRICE macro.
+#define TRICE_LEAVE //! TRICE_LEAVE is the end of TRICE macro.
+#define TRICE_HALF_BUFFER_SIZE 256 //!< This is the size of each buffer slot.
+#define TRICE_BUFFER_SLOTS 4 //!< Queue up to 3 packages while the DMA is busy.
+#define TRICE_SINGLE_MAX_SIZE 64 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+
+#define TRICE_INLINE static inline //! used for trice code
+
+#define ALIGN4                                  //!< align to 4 byte boundary preamble
+#define ALIGN4_END __attribute__ ((aligned(4))) //!< align to 4 byte boundary post declaration
+
+//! TRICE_ENTER_CRITICAL_SECTION saves interrupt state and disables Interrupts.
+#define TRICE_ENTER_CRITICAL_SECTION {
+
+//! TRICE_LEAVE_CRITICAL_SECTION restores interrupt state.
+#define TRICE_LEAVE_CRITICAL_SECTION }
+
+//! triceStartDmaTransmit is the DMA start hook. Here it is a mock only recording its parameters.
+void triceStartDmaTransmit( uint8_t const * buf, unsigned len );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
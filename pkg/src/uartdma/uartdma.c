@@ -0,0 +1,42 @@
+/*! \file uartdma.c
+\brief trice.c compiled with UART DMA configuration and a DMA mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "uartdma.h"
+
+static uint8_t const * dmaBuffer; //!< dmaBuffer is the source address of the running DMA transfer.
+static unsigned dmaLength = 0;    //!< dmaLength is the byte count of the running DMA transfer.
+static int dmaStarts = 0;         //!< dmaStarts counts the DMA transfer starts.
+
+//! triceStartDmaTransmit mocks the DMA start. The transfer gets complete with DmaComplete.
+void triceStartDmaTransmit( uint8_t const * buf, unsigned len ){
+    dmaBuffer = buf;
+    dmaLength = len;
+    dmaStarts++;
+}
+
+//! DmaStarts returns the count of DMA transfer starts.
+int DmaStarts( void ){
+    return dmaStarts;
+}
+
+//! DmaComplete simulates the end of the running DMA transfer and the transfer complete interrupt.
+//! It copies the transferred bytes into out and returns their count.
+int DmaComplete( uint8_t* out ){
+    unsigned len = dmaLength;
+    memcpy( out, dmaBuffer, len );
+    dmaLength = 0;
+    TriceDmaTransmitComplete();
+    return len;
+}
+
+//! TriceValue writes a single trice with value v into the trice buffer.
+void TriceValue( int v ){
+    TRICE32_1( Id(58755), "rd:TRICE32_1 line %d (%%d)\n", v );
+}
+
+//! OutDepth returns TriceOutDepth().
+int OutDepth( void ){
+    return TriceOutDepth();
+}
@@ -0,0 +1,38 @@
+// Package uartdma tests the trice UART DMA transmit backend on the host.
+// The target C-code is compiled with a local triceConfig.h and the DMA hardware is replaced by a mock.
+package uartdma
+
+// #include <stdint.h>
+// #include "uartdma.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// dmaStarts returns the count of DMA transfer starts.
+func dmaStarts() int {
+	return int(C.DmaStarts())
+}
+
+// dmaComplete finishes the running DMA transfer and returns the transferred bytes.
+func dmaComplete() []byte {
+	o := make([]byte, 1024)
+	n := C.DmaComplete((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceValue writes a single trice with value v.
+func triceValue(v int) {
+	C.TriceValue(C.int(v))
+}
+
+// outDepth returns the byte count the DMA has not finished yet.
+func outDepth() int {
+	return int(C.OutDepth())
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
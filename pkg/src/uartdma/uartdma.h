@@ -0,0 +1,12 @@
+/*! \file uartdma.h
+\brief UART DMA mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int DmaStarts( void );
+int DmaComplete( uint8_t* out );
+void TriceValue( int v );
+int OutDepth( void );
+void TriceTransfer( void );
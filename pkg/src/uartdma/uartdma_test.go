@@ -0,0 +1,77 @@
+package uartdma
+
+import (
+	"encoding/binary"
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// decode returns the values of the TRICE32_1 trices inside the COBS packages in b.
+func decode(t *testing.T, b []byte) (cycles []byte, values []int32) {
+	for _, d := range tricetest.Packages(t, b) {
+		assert.Equal(t, uint32(0), binary.LittleEndian.Uint32(d)) // COBS package descriptor
+		for d = d[4:]; len(d) >= 8; d = d[8:] {
+			head := binary.LittleEndian.Uint32(d)
+			assert.Equal(t, uint32(58755), head>>16)
+			cycles = append(cycles, byte(head))
+			values = append(values, int32(binary.LittleEndian.Uint32(d[4:])))
+		}
+	}
+	return
+}
+
+// TestDMAStateMachine checks, that TriceTransfer starts a DMA transfer only when the previous one is complete.
+func TestDMAStateMachine(t *testing.T) {
+	assert.Equal(t, 0, outDepth())
+	triceTransfer() // nothing to transfer
+	assert.Equal(t, 0, dmaStarts())
+
+	triceValue(1)
+	triceValue(2)
+	triceTransfer()
+	assert.Equal(t, 1, dmaStarts())
+	depth := outDepth()
+	assert.True(t, depth > 0)
+
+	triceValue(3)
+	triceTransfer() // DMA busy, no swap
+	assert.Equal(t, 1, dmaStarts())
+	assert.Equal(t, depth, outDepth())
+
+	cycles, values := decode(t, dmaComplete())
+	assert.Equal(t, []byte{0xc0, 0xc1}, cycles)
+	assert.Equal(t, []int32{1, 2}, values)
+	assert.Equal(t, 0, outDepth())
+
+	triceTransfer()
+	assert.Equal(t, 2, dmaStarts())
+	cycles, values = decode(t, dmaComplete())
+	assert.Equal(t, []byte{0xc2}, cycles)
+	assert.Equal(t, []int32{3}, values)
+
+	triceTransfer() // nothing to transfer
+	assert.Equal(t, 2, dmaStarts())
+	assert.Equal(t, 0, outDepth())
+}
+
+// TestDMAQueue checks, that with 4 buffer slots up to 3 packages get queued while the DMA is busy.
+func TestDMAQueue(t *testing.T) {
+	starts := dmaStarts()
+	for i := 10; i < 14; i++ { // 1st transfer starts the DMA, 2nd and 3rd queue a slot, 4th finds no free slot
+		triceValue(i)
+		triceTransfer()
+	}
+	assert.Equal(t, starts+1, dmaStarts())
+	for i := 10; i < 14; i++ {
+		_, values := decode(t, dmaComplete())
+		assert.Equal(t, []int32{int32(i)}, values)
+		triceTransfer()
+	}
+	assert.Equal(t, starts+4, dmaStarts())
+	_, values := decode(t, dmaComplete())
+	assert.Equal(t, 0, len(values))
+	triceTransfer()
+	assert.Equal(t, 0, outDepth())
+}
@@ -0,0 +1,67 @@
+/*! \file til.h
+\brief trice ID metadata generated by "trice update -tilh" from the trice ID list. Do not edit.
+*******************************************************************************/
+
+#ifndef TIL_H_
+#define TIL_H_
+
+#include <stdint.h>
+
+#ifndef TRICE_INLINE
+#define TRICE_INLINE static inline
+#endif
+
+// Channel levels like used by the trice tool -logLevel switch. A bigger value is less important.
+#define TRICE_LEVEL_FATAL 0
+#define TRICE_LEVEL_CRITICAL 1
+#define TRICE_LEVEL_EMERGENCY 2
+#define TRICE_LEVEL_ERROR 3
+#define TRICE_LEVEL_WARNING 4
+#define TRICE_LEVEL_ATT 5
+#define TRICE_LEVEL_INFO 6
+#define TRICE_LEVEL_DEBUG 7
+#define TRICE_LEVEL_TRACE 8
+#define TRICE_LEVEL_TIMESTAMP 9
+#define TRICE_LEVEL_MSG 10
+#define TRICE_LEVEL_READ 11
+#define TRICE_LEVEL_WRITE 12
+#define TRICE_LEVEL_RECEIVE 13
+#define TRICE_LEVEL_TRANSMIT 14
+#define TRICE_LEVEL_DIA 15
+#define TRICE_LEVEL_INT 16
+#define TRICE_LEVEL_SIG 17
+#define TRICE_LEVEL_TST 18
+#define TRICE_LEVEL_DEFAULT 19
+#define TRICE_LEVEL_NOTICE 20
+#define TRICE_LEVEL_ALERT 21
+#define TRICE_LEVEL_ASSERT 22
+#define TRICE_LEVEL_ALARM 23
+#define TRICE_LEVEL_CYCLE 24
+#define TRICE_LEVEL_LOST 25
+#define TRICE_LEVEL_VERBOSE 26
+
+#define TRICE_TIL_MAX_SIZE 8 //!< TRICE_TIL_MAX_SIZE is the biggest head plus parameter size of all trices without dynamic length.
+
+// Channel, level and parameter byte size for each ID. Dynamic length trices have size -1.
+#define TIL_1101_CHANNEL "dbg"
+#define TIL_1101_LEVEL 7
+#define TIL_1101_SIZE 4
+#define TIL_1102_CHANNEL "msg"
+#define TIL_1102_LEVEL 10
+#define TIL_1102_SIZE 4
+#define TIL_1103_CHANNEL "err"
+#define TIL_1103_LEVEL 3
+#define TIL_1103_SIZE 4
+
+//! triceIdLevel returns the channel level of a trice id like Id(58755).
+//! For a constant id the compiler folds it to a constant, so with TRICE_LEVEL the trices above it generate no code.
+TRICE_INLINE int triceIdLevel( uint32_t id ){
+    switch( id >> 16 ){
+        case 1101: return TIL_1101_LEVEL;
+        case 1102: return TIL_1102_LEVEL;
+        case 1103: return TIL_1103_LEVEL;
+        default: return 0;
+    }
+}
+
+#endif // TIL_H_
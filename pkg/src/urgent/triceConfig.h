@@ -0,0 +1,24 @@
+/*! \file triceConfig.h
+\brief trice configuration for the urgent trice buffer host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_URGENT_BUFFER_SIZE 128 //!< Urgent trices are transmitted first.
+#define TRICE_URGENT_LEVEL TRICE_LEVEL_ERROR //!< Trices with err: and more important channels are urgent.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,23 @@
+/*! \file urgent.c
+\brief trice.c compiled with the urgent trice buffer and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "trice.h"
+#include "urgent.h"
+
+//! TriceBulk writes a normal trice with value v into the trice buffer.
+void TriceBulk( int v ){
+    TRICE32_1( Id(1101), "dbg:bulk %d\n", v );
+}
+
+//! TriceUrgentValue writes an explicit urgent trice with value v into the urgent buffer.
+void TriceUrgentValue( int v ){
+    TRICE_URGENT( TRICE32_1( Id(1102), "msg:urgent %d\n", v ) );
+}
+
+//! TriceError writes an err: trice with value v, which is urgent because of TRICE_URGENT_LEVEL.
+void TriceError( int v ){
+    TRICE32_1( Id(1103), "err:error %d\n", v );
+}
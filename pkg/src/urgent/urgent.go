@@ -0,0 +1,38 @@
+// Package urgent tests the urgent trice buffer on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package urgent
+
+// #include <stdint.h>
+// #include "urgent.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 1024)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceBulk writes a normal trice with value v.
+func triceBulk(v int) {
+	C.TriceBulk(C.int(v))
+}
+
+// triceUrgent writes an explicit urgent trice with value v.
+func triceUrgent(v int) {
+	C.TriceUrgentValue(C.int(v))
+}
+
+// triceError writes an err: trice with value v.
+func triceError(v int) {
+	C.TriceError(C.int(v))
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
@@ -0,0 +1,12 @@
+/*! \file urgent.h
+\brief urgent trice buffer mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceBulk( int v );
+void TriceUrgentValue( int v );
+void TriceError( int v );
+void TriceTransfer( void );
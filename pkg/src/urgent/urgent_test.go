@@ -0,0 +1,44 @@
+package urgent
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// values returns the COBS package descriptor and the cycle and first parameter of each trice inside the only COBS package in b.
+func values(t *testing.T, b []byte) (descriptor int, cycles, r []int) {
+	d := tricetest.Package(t, b)
+	if len(d) < 4 {
+		return
+	}
+	descriptor = int(d[0])
+	for d = d[4:]; len(d) >= 8; {
+		cycles = append(cycles, int(d[0]))
+		r = append(r, int(d[4]))
+		d = d[4+4*int(d[1]):]
+	}
+	return
+}
+
+// TestUrgent checks, that urgent trices are transmitted first and do not advance the cycle counter.
+func TestUrgent(t *testing.T) {
+	triceBulk(1)
+	triceUrgent(2)
+	triceBulk(3)
+	triceError(4)
+	triceTransfer()
+	desc, _, v := values(t, written())
+	assert.Equal(t, 32, desc)
+	assert.Equal(t, []int{2, 4}, v)
+
+	triceTransfer()
+	desc, c, v := values(t, written())
+	assert.Equal(t, 0, desc)
+	assert.Equal(t, []int{1, 3}, v)
+	assert.Equal(t, []int{0xc0, 0xc1}, c)
+
+	triceTransfer()
+	assert.Equal(t, 0, len(written()))
+}
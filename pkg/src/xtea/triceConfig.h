@@ -0,0 +1,35 @@
+/*! \file triceConfig.h
+\brief trice configuration for the XTEA host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret
+#define TRICE_DECRYPT //!< TRICE_DECRYPT is usually not needed. Enable for checks.
+#define TRICE_ENCRYPT_CTR //!< XTEA counter mode
+#define TRICE_KEYSTREAM_BLOCKS 8 //!< 64 bytes precomputed keystream
+#define TRICE_CTR_NONCE 0x01020304 //!< fixed nonce for tests
+
+#define TRICE_STACK_BUFFER_MAX_SIZE 128 //!< not used here
+
+//! TRICE_WRITE is not used here.
+#define TRICE_WRITE( buf, len ) do{ ((void)(buf)); ((void)(len)); }while(0)
+
+#define TRICE_INLINE static inline //! used for trice code
+
+#define ALIGN4                                  //!< align to 4 byte boundary preamble
+#define ALIGN4_END __attribute__ ((aligned(4))) //!< align to 4 byte boundary post declaration
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,5 @@
+/*! \file xtea.c
+\brief trice.c compiled with XTEA encryption for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
@@ -0,0 +1,31 @@
+// Package xtea tests the trice target XTEA encryption on the host.
+// The target C-code is compiled with a local triceConfig.h containing the key for password "MySecret".
+package xtea
+
+// #include <stdint.h>
+// #include "xtea.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// encrypt enciphers w in place with XTEA, 8 bytes at once. len(w) must be even.
+func encrypt(w []uint32) {
+	C.TriceEncrypt((*C.uint32_t)(unsafe.Pointer(&w[0])), C.unsigned(len(w)))
+}
+
+// decrypt deciphers w in place with XTEA, 8 bytes at once. len(w) must be even.
+func decrypt(w []uint32) {
+	C.TriceDecrypt((*C.uint32_t)(unsafe.Pointer(&w[0])), C.unsigned(len(w)))
+}
+
+// encryptCTR encrypts w[2:] in counter mode and writes counter and nonce into w[0] and w[1].
+func encryptCTR(w []uint32) {
+	C.TriceEncryptCTR((*C.uint32_t)(unsafe.Pointer(&w[0])), C.unsigned(len(w)-2))
+}
+
+// keystreamFill precomputes keystream blocks.
+func keystreamFill() {
+	C.TriceKeystreamFill()
+}
@@ -0,0 +1,11 @@
+/*! \file xtea.h
+\brief XTEA interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+void TriceEncrypt( uint32_t* p, unsigned count );
+void TriceDecrypt( uint32_t* p, unsigned count );
+void TriceEncryptCTR( uint32_t* p, unsigned count );
+void TriceKeystreamFill( void );
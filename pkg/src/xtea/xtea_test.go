@@ -0,0 +1,100 @@
+package xtea
+
+import (
+	"bytes"
+	"encoding/binary"
+	"os"
+	"testing"
+
+	"github.com/rokath/trice/pkg/cipher"
+	"github.com/tj/assert"
+)
+
+// bytesOf returns w as little endian bytes like a target transmits them.
+func bytesOf(w []uint32) []byte {
+	b := make([]byte, 4*len(w))
+	for i, x := range w {
+		binary.LittleEndian.PutUint32(b[4*i:], x)
+	}
+	return b
+}
+
+// words returns n test data words.
+func words(n int) []uint32 {
+	w := make([]uint32, n)
+	for i := range w {
+		w[i] = uint32(i)*0x01010101 + 0x00c0ffee
+	}
+	return w
+}
+
+func setUp(t *testing.T, mode string) {
+	cipher.Password = "MySecret"
+	cipher.Mode = mode
+	assert.Nil(t, cipher.SetUp(os.Stdout))
+}
+
+// TestECB checks the compile time round table against the host decryption.
+func TestECB(t *testing.T) {
+	setUp(t, "ECB")
+	w := words(6)
+	exp := bytesOf(w)
+	encrypt(w)
+	b := bytesOf(w)
+	assert.False(t, bytes.Equal(exp, b))
+	cipher.Decrypt(b, b)
+	assert.Equal(t, exp, b)
+	decrypt(w)
+	assert.Equal(t, exp, bytesOf(w))
+}
+
+// TestCTR checks counter mode with and without precomputed keystream against the host decryption.
+func TestCTR(t *testing.T) {
+	setUp(t, "CTR")
+	var next uint32
+	for _, fill := range []bool{false, true, true, false} {
+		for _, n := range []int{1, 2, 7, 20} { // 20 words need more than the 8 precomputed blocks
+			if fill {
+				keystreamFill()
+			}
+			w := append([]uint32{0, 0}, words(n)...)
+			exp := bytesOf(w[2:])
+			encryptCTR(w)
+			assert.Equal(t, next, w[0])               // keystream counter
+			assert.Equal(t, uint32(0x01020304), w[1]) // nonce
+			next += uint32(n+1) / 2
+			b := bytesOf(w)
+			assert.False(t, bytes.Equal(exp, b[8:]))
+			m := cipher.DecryptCTR(b, b)
+			assert.Equal(t, 4*n, m)
+			assert.Equal(t, exp, b[:m])
+		}
+	}
+}
+
+// BenchmarkEncryptECB64 measures 64 bytes XTEA block encryption on the target side.
+func BenchmarkEncryptECB64(b *testing.B) {
+	w := words(16)
+	for i := 0; i < b.N; i++ {
+		encrypt(w)
+	}
+}
+
+// BenchmarkEncryptCTR64 measures 64 bytes counter mode encryption computing the keystream in the hot path.
+func BenchmarkEncryptCTR64(b *testing.B) {
+	w := words(18)
+	for i := 0; i < b.N; i++ {
+		encryptCTR(w)
+	}
+}
+
+// BenchmarkEncryptCTR64Precomputed measures 64 bytes counter mode encryption with keystream precomputed in idle time.
+func BenchmarkEncryptCTR64Precomputed(b *testing.B) {
+	w := words(18)
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		keystreamFill()
+		b.StartTimer()
+		encryptCTR(w)
+	}
+}
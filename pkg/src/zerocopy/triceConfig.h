@@ -0,0 +1,28 @@
+/*! \file triceConfig.h
+\brief trice configuration for the zero-copy TRICE_N host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#ifndef TRICE_CONFIG_H_
+#define TRICE_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRICE_ZERO_COPY //!< TRICE_BY_REFERENCE writes only buffer references into the trice buffer.
+
+#define TRICE_HALF_BUFFER_SIZE 1024 //!< This is the size of each of both buffers.
+#define TRICE_SINGLE_MAX_SIZE 512 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+
+#define TRICE_WRITE_MOCK_SIZE 4096 //!< The referenced buffers of several transfers.
+
+#include "../inc/triceMockConfig.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRICE_CONFIG_H_ */
@@ -0,0 +1,18 @@
+/*! \file zerocopy.c
+\brief trice.c compiled with zero-copy buffer references and an output mock for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include "../trice.c"
+#include "../inc/triceWriteMock.c"
+#include "trice.h"
+#include "zerocopy.h"
+
+//! TriceCopy writes len bytes from buf with TRICE_N as copy.
+void TriceCopy( uint8_t const* buf, unsigned len ){
+    TRICE_N( Id(1301), "msg:%s\n", buf, len );
+}
+
+//! TriceByRef writes len bytes from buf with TRICE_N as reference.
+void TriceByRef( uint8_t const* buf, unsigned len ){
+    TRICE_BY_REFERENCE( TRICE_N( Id(1301), "msg:%s\n", buf, len ) );
+}
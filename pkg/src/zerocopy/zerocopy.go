@@ -0,0 +1,45 @@
+// Package zerocopy tests the zero-copy TRICE_N buffer references on the host.
+// The target C-code is compiled with a local triceConfig.h and the output is replaced by a mock.
+package zerocopy
+
+// #include <stdint.h>
+// #include <stdlib.h>
+// #include "zerocopy.h"
+// #cgo CFLAGS: -g -Wall -I. -I..
+import "C"
+import (
+	"unsafe"
+)
+
+// written returns the bytes written since the last call.
+func written() []byte {
+	o := make([]byte, 4096)
+	n := C.Written((*C.uint8_t)(unsafe.Pointer(&o[0])))
+	return o[:n]
+}
+
+// triceCopy writes b with TRICE_N.
+func triceCopy(b []byte) {
+	C.TriceCopy((*C.uint8_t)(unsafe.Pointer(&b[0])), C.unsigned(len(b)))
+}
+
+// triceByReference writes b with TRICE_N inside TRICE_BY_REFERENCE.
+// b must be C memory, because the target keeps the pointer.
+func triceByReference(b []byte) {
+	C.TriceByRef((*C.uint8_t)(unsafe.Pointer(&b[0])), C.unsigned(len(b)))
+}
+
+// referenced returns true as long as the target references b.
+func referenced(b []byte) bool {
+	return C.TriceReferenced(unsafe.Pointer(&b[0]), C.uint32_t(len(b))) != 0
+}
+
+// cBuffer returns a byte slice of size n in C memory. It is never freed.
+func cBuffer(n int) []byte {
+	return (*[1 << 20]byte)(C.malloc(C.size_t(n)))[:n:n]
+}
+
+// triceTransfer calls TriceTransfer.
+func triceTransfer() {
+	C.TriceTransfer()
+}
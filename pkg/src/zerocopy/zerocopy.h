@@ -0,0 +1,12 @@
+/*! \file zerocopy.h
+\brief zero-copy TRICE_N mock interface for host tests
+\author Thomas.Hoehenleitner [at] seerose.net
+*******************************************************************************/
+
+#include <stdint.h>
+
+int Written( uint8_t* out );
+void TriceCopy( uint8_t const* buf, unsigned len );
+void TriceByRef( uint8_t const* buf, unsigned len );
+int TriceReferenced( void const* buf, uint32_t len );
+void TriceTransfer( void );
@@ -0,0 +1,44 @@
+package zerocopy
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/pkg/src/tricetest"
+	"github.com/tj/assert"
+)
+
+// decoded returns the COBS decoded only package in b with the cycle counter of the first trice cleared.
+func decoded(t *testing.T, b []byte) []byte {
+	d := tricetest.Package(t, b)
+	d[4] = 0
+	return d
+}
+
+// TestZeroCopy checks, that a referenced buffer gives the same package as a copied one and is read during the transfer.
+func TestZeroCopy(t *testing.T) {
+	buf := cBuffer(300)
+	for i := range buf {
+		buf[i] = byte(i%255 + 1) // more than 254 bytes without 0 for a COBS block limit
+	}
+	buf[280] = 0
+
+	triceCopy(buf)
+	triceTransfer()
+	exp := written()
+	assert.Equal(t, 0, len(exp)&3)
+
+	triceByReference(buf)
+	assert.True(t, referenced(buf[100:101]))
+	buf[0] = 0x55 // the reference is read during the transfer
+	triceTransfer()
+	act := written()
+	assert.Equal(t, len(exp), len(act))
+	e, a := decoded(t, exp), decoded(t, act)
+	assert.Equal(t, byte(1), e[12])
+	e[12] = 0x55
+	assert.Equal(t, e, a)
+
+	assert.True(t, referenced(buf))
+	triceTransfer() // transmission done
+	assert.False(t, referenced(buf))
+}
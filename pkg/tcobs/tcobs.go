@@ -0,0 +1,163 @@
+// Package tcobs implements TCOBS, a COBS variant with run length compression (see docs/TCOBSSpecification.md).
+//
+// A TCOBS frame contains no 0 bytes and ends with a sigil byte.
+// Each sigil byte contains the count of literal bytes between it and the previous sigil byte (offset).
+// The decoding starts at the frame end.
+package tcobs
+
+import (
+	"errors"
+)
+
+// Sigil bytes. The lower 5 bits (3 bits for R2-R4) are the offset.
+const (
+	N  = 0xA0 // N is the no-operation sigil 101ooooo.
+	Z1 = 0x20 // Z1 is the sigil 001ooooo for 1 zero.
+	Z2 = 0x40 // Z2 is the sigil 010ooooo for 2 zeroes.
+	Z3 = 0x60 // Z3 is the sigil 011ooooo for 3 zeroes.
+	F2 = 0xC0 // F2 is the sigil 110ooooo for 2 0xFF.
+	F3 = 0xE0 // F3 is the sigil 111ooooo for 3 0xFF.
+	F4 = 0x80 // F4 is the sigil 100ooooo for 4 0xFF.
+	R2 = 0x08 // R2 is the sigil 00001ooo for 2 repetitions of the previous byte.
+	R3 = 0x10 // R3 is the sigil 00010ooo for 3 repetitions of the previous byte.
+	R4 = 0x18 // R4 is the sigil 00011ooo for 4 repetitions of the previous byte.
+)
+
+var (
+	zSigil = []byte{0, Z1, Z2, Z3}
+	fSigil = []byte{0, 0, F2, F3, F4}
+	rSigil = []byte{0, 0, R2, R3, R4}
+)
+
+// Encode encodes i into o and returns the count of bytes written to o.
+//
+// o needs a size of at least len(i) + len(i)/31 + 1. No 0-delimiter is added.
+// The output is identical to the C function TCOBSEncode.
+func Encode(o, i []byte) (n int) {
+	offset := 0 // literal bytes count since last sigil
+	sigil := func(s byte) {
+		o[n] = s | byte(offset)
+		n++
+		offset = 0
+	}
+	literal := func(b byte) {
+		o[n] = b
+		n++
+		offset++
+		if offset == 31 {
+			sigil(N)
+		}
+	}
+	for len(i) > 0 {
+		b := i[0]
+		r := 1 // run length of b
+		for r < len(i) && i[r] == b {
+			r++
+		}
+		i = i[r:]
+		switch {
+		case b == 0:
+			for r > 0 {
+				k := min(r, 3)
+				sigil(zSigil[k])
+				r -= k
+			}
+		case b == 0xFF && r > 1:
+			for r > 1 {
+				k := min(r, 4)
+				sigil(fSigil[k])
+				r -= k
+			}
+			if r == 1 {
+				literal(b)
+			}
+		default:
+			literal(b)
+			r--
+			for r > 1 {
+				k := min(r, 4)
+				if offset > 7 { // R sigils have only 3 offset bits
+					sigil(N)
+				}
+				sigil(rSigil[k])
+				r -= k
+			}
+			if r == 1 {
+				literal(b)
+			}
+		}
+	}
+	if offset > 0 { // a frame ends always with a sigil
+		sigil(N)
+	}
+	return
+}
+
+// min returns the smaller of a and b.
+func min(a, b int) int {
+	if a < b {
+		return a
+	}
+	return b
+}
+
+// part is a decoded frame part: literal bytes followed by a sigil.
+type part struct {
+	literals []byte
+	sigil    byte
+}
+
+// Decode decodes the TCOBS frame in (without 0-delimiter) into d and returns the decoded length.
+//
+// decoded := d[:n]
+func Decode(d, in []byte) (n int, e error) {
+	parts := make([]part, 0, 16)
+	for len(in) > 0 { // walk backwards
+		s := in[len(in)-1]
+		in = in[:len(in)-1]
+		offset := int(s & 0x1F)
+		if s < 0x20 { // R sigil or invalid
+			if s < R2 {
+				e = errors.New("inconsistent TCOBS packet: invalid sigil byte")
+				return
+			}
+			offset = int(s & 7)
+		}
+		if offset > len(in) {
+			e = errors.New("inconsistent TCOBS packet: offset exceeds frame")
+			return
+		}
+		parts = append(parts, part{in[len(in)-offset:], s})
+		in = in[:len(in)-offset]
+	}
+	for k := len(parts) - 1; k >= 0; k-- { // emit forwards
+		p := parts[k]
+		if n+len(p.literals)+4 > len(d) {
+			e = errors.New("TCOBS decode buffer too small")
+			return
+		}
+		n += copy(d[n:], p.literals)
+		var b byte
+		var count int
+		switch p.sigil & 0xE0 {
+		case N:
+		case Z1, Z2, Z3:
+			b, count = 0, int(p.sigil>>5)
+		case F2, F3:
+			b, count = 0xFF, int(p.sigil>>5)-4
+		case F4:
+			b, count = 0xFF, 4
+		default: // R2, R3, R4
+			if n == 0 {
+				e = errors.New("inconsistent TCOBS packet: repeat sigil without previous byte")
+				return
+			}
+			b, count = d[n-1], int(p.sigil>>3)+1
+		}
+		for ; count > 0; count-- {
+			d[n] = b
+			n++
+		}
+	}
+	return
+}
@@ -0,0 +1,76 @@
+package tcobs
+
+import (
+	"math/rand"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+type testTable []struct {
+	dec []byte
+	enc []byte
+}
+
+// testData is identical with the TCOBSTestData in pkg/src/triceCheck.c.
+var testData = testTable{
+	{[]byte{0}, []byte{0x20}},
+	{[]byte{0xFF}, []byte{0xFF, 0xA1}},
+	{[]byte{0, 0, 0, 0, 0, 0xFF}, []byte{0x60, 0x40, 0xFF, 0xA1}},
+	{[]byte{0xAA, 0x02, 0x02, 0x00, 0xFF}, []byte{0xAA, 0x02, 0x02, 0x23, 0xFF, 0xA1}},
+	{[]byte{0xFF, 0x02, 0x02, 0x00, 0xFF}, []byte{0xFF, 0x02, 0x02, 0x23, 0xFF, 0xA1}},
+	{[]byte{0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, []byte{0x80, 0xFF, 0xA1}},
+	{[]byte{0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22}, []byte{0x11, 0x09, 0x22, 0x19}},
+	{[]byte{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x99, 0x99}, []byte{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xA9, 0x08}},
+	{[]byte{}, []byte{}},
+}
+
+func TestEncode(t *testing.T) {
+	o := make([]byte, 100)
+	for _, x := range testData {
+		n := Encode(o, x.dec)
+		assert.Equal(t, x.enc, o[:n])
+	}
+}
+
+func TestDecode(t *testing.T) {
+	d := make([]byte, 100)
+	for _, x := range testData {
+		n, e := Decode(d, x.enc)
+		assert.Nil(t, e)
+		assert.Equal(t, x.dec, d[:n])
+	}
+}
+
+func TestDecodeInvalid(t *testing.T) {
+	d := make([]byte, 100)
+	for _, x := range [][]byte{{0x05}, {0x11, 0xA5}, {0x08}} {
+		_, e := Decode(d, x)
+		assert.NotNil(t, e)
+	}
+}
+
+// TestRoundTrip encodes and decodes random data with long runs.
+func TestRoundTrip(t *testing.T) {
+	r := rand.New(rand.NewSource(1))
+	o := make([]byte, 2000)
+	d := make([]byte, 2000)
+	for k := 0; k < 2000; k++ {
+		size := r.Intn(1000)
+		i := make([]byte, 0, size+12)
+		for len(i) < size {
+			b := []byte{0, 0xFF, 0x55, byte(r.Intn(256))}[r.Intn(4)]
+			for c := r.Intn(12); c >= 0; c-- {
+				i = append(i, b)
+			}
+		}
+		n := Encode(o, i)
+		assert.True(t, n <= len(i)+len(i)/31+1)
+		for _, b := range o[:n] {
+			assert.True(t, b != 0)
+		}
+		m, e := Decode(d, o[:n])
+		assert.Nil(t, e)
+		assert.Equal(t, i, d[:m])
+	}
+}
@@ -27,6 +27,8 @@ extern uint32_t ReadTime( void );
 // Enabling next 2 lines results in XTEA TriceEncryption  with the key.
 //#define TRICE_ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret
 //#define TRICE_DECRYPT //!< TRICE_DECRYPT is usually not needed. Enable for checks.
+//#define TRICE_ENCRYPT_CTR //!< Enable additionally for XTEA counter mode: call TriceKeystreamFill() in idle time. Needs "-cipherMode CTR" for the trice tool.
+//#define TRICE_CTR_NONCE BootCount //!< Needed for TRICE_ENCRYPT_CTR: a value changing with each reset, like a boot counter incremented in non-volatile memory at startup.
 
 //#define TRICE_BIG_ENDIANNESS //!< TRICE_BIG_ENDIANNESS needs to be defined for TRICE64 macros on big endian devices. (Untested!)
 
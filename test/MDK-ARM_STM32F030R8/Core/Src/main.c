@@ -146,9 +146,6 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
-  #ifdef TRICE_ENCRYPT
-    TriceInitXteaTable();
-  #endif
     #ifdef TRICE_UART
     LL_USART_EnableIT_RXNE(TRICE_UART); // enable UART2 interrupt
     #endif
@@ -174,7 +171,7 @@ int main(void)
             TRICE( Id(64230), "att:...done\n" );
         }
         // serve every few ms
-        #ifdef TRICE_HALF_BUFFER_SIZE
+        #ifdef TRICE_DEFERRED_OUT
         static int lastMs = 0;
         if( milliSecond >= lastMs + TRICE_TRANSFER_INTERVAL_MS ){
             lastMs = milliSecond;
@@ -207,6 +204,9 @@ int main(void)
             }
         }
         serveUs();
+        #ifdef TRICE_ENCRYPT_CTR
+        TriceKeystreamFill(); // precompute keystream in idle time
+        #endif
         __WFI(); // wait for interrupt (sleep)
         serveUs();
     }
@@ -19,14 +19,42 @@ extern "C" {
 
 #define TRICE_RTT_CHANNEL 0 //!< Enable and set channel number for SeggerRTT usage.
 //#define TRICE_UART USART2   //!< Enable and set UART for serial output.
+//#define TRICE_UART_DMA      //!< Enable together with TRICE_UART and a buffered TRICE_MODE for DMA transmit instead of TXE interrupts.
 
 extern uint32_t ReadTime( void );
 #define TRICE_LOCATION (TRICE_FILE| __LINE__) //!< Enable if you need target location. TRICE_FILE occcupies the upper 16 bit.
 #define TRICE_TIMESTAMP ReadTime()            //!< Enable if you need target timestamps. You must provide ReadTime() returning a 32-bit value of your choice, like microSecond.
+//#define TRICE_SPAN_CLOCK() (SysTick->LOAD - SysTick->VAL) //!< TRICE_SPAN_BEGIN and TRICE_SPAN_END use TRICE_TIMESTAMP, because the Cortex-M0+ has no cycle counter. Enable for spans shorter than 1 ms in clock ticks.
+//#define TRICE_FUNCTION_TRACE //!< Enable and compile the application files with -finstrument-functions for function entry and exit records. Uses TRICE_FUNCTION_CLOCK(), per default TRICE_SPAN_CLOCK().
+//#define TRICE_DELTA_TIMESTAMP //!< Enable with TRICE_TIMESTAMP for one absolute timestamp per COBS package and a 16-bit delta per trice.
+//#define TRICE_PACKED_PARAMS //!< Enable to send small parameter values as zigzag varints, typically 1-2 bytes instead of 4.
+//#define TRICE_ID_BITMAP_BITS 1024 //!< Enable for switching trice IDs on and off at runtime with "off dbg" or "on 4711" in the trice tool console (-ds). Needs 128 bytes RAM.
+//#define TRICE_LEVEL TRICE_LEVEL_WARNING //!< Enable to compile out all trices with less important channels than wrn:. Needs til.h from "trice update -tilh til.h".
 
 // Enabling next 2 lines results in XTEA TriceEncryption  with the key.
 //#define TRICE_ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret
 //#define TRICE_DECRYPT //!< TRICE_DECRYPT is usually not needed. Enable for checks.
+//#define TRICE_ENCRYPT_CTR //!< Enable additionally for XTEA counter mode: call TriceKeystreamFill() in idle time. Needs "-cipherMode CTR" for the trice tool.
+//#define TRICE_CTR_NONCE BootCount //!< Needed for TRICE_ENCRYPT_CTR: a value changing with each reset, like a boot counter incremented in non-volatile memory at startup.
+
+//#define TRICE_TCOBS //!< Enable for TCOBS framing with run length compression. Needs "-encoding TCOBS" for the trice tool and tcobs.c added to the project.
+//#define TRICE_COBS_ENCODE TriceCOBSEncode32 //!< Enable for faster COBS encoding with 32-bit zero checks (more code). Output is identical.
+
+//#define TRICE_BUFFER_OVERFLOW_PROTECTION //!< Enable with TRICE_HALF_BUFFER_SIZE to drop trices not fitting into the buffer. The trice tool shows "LOST:" lines then.
+
+//#define TRICE_RATE_LIMIT_SLOTS 64 //!< Enable with TRICE_HALF_BUFFER_SIZE to limit each trice ID to TRICE_RATE_LIMIT_BURST trices per TriceTransfer call. Needs 192 bytes RAM.
+//#define TRICE_RATE_LIMIT_PERIOD 640000 //!< Enable to count the TRICE_RATE_LIMIT_BURST trices per 10 ms of the 64 MHz DWT cycle counter instead per TriceTransfer call. Needed with TRICE_FLUSH_HIGH_WATER.
+
+//#define TRICE_NOINIT __attribute__((section(".bss.noinit"))) //!< Enable with TRICE_HALF_BUFFER_SIZE to keep the trice buffer over resets. The scatter file must not zero this section.
+
+//#define TRICE_URGENT_BUFFER_SIZE 128 //!< Enable with TRICE_HALF_BUFFER_SIZE for a double buffer transmitted before the others. Use TRICE_URGENT( TRICE(...) ); or TRICE_URGENT_LEVEL.
+
+//#define TRICE_FRAGMENTS //!< Enable to stream TRICE_N and TRICE_S buffers bigger than TRICE_SINGLE_MAX_SIZE as fragments. The trice tool reassembles them.
+
+//#define TRICE_ZERO_COPY //!< Enable with TRICE_HALF_BUFFER_SIZE and RTT output to write TRICE_N buffers inside TRICE_BY_REFERENCE only as reference. TriceTransfer encodes them from the app memory.
+//#define TRICE_FUNCTIONS //!< Enable to let the TRICE macros call shared functions in trice.c. That saves flash with many trices for a function call per trice.
+
+//#define TRICE_FLUSH_HIGH_WATER 500 //!< Enable with TRICE_HALF_BUFFER_SIZE to call TRICE_FLUSH_REQUEST, when the write position crosses this half buffer byte offset.
 
 //#define TRICE_BIG_ENDIANNESS //!< TRICE_BIG_ENDIANNESS needs to be defined for TRICE64 macros on big endian devices. (Untested!)
 
@@ -70,6 +98,7 @@ extern uint32_t ReadTime( void );
 #endif
 #define TRICE_HALF_BUFFER_SIZE 1000 //!< This is the size of each of both buffers. Must be able to hold the max TRICE burst count within TRICE_TRANSFER_INTERVAL_MS or even more, if the write out speed is small. Must not exceed SEGGER BUFFER_SIZE_UP
 #define TRICE_SINGLE_MAX_SIZE 100 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
+//#define TRICE_BUFFER_SLOTS 4 //!< Enable with TRICE_HALF_BUFFER_SIZE 256 for a package queue: TRICE macros write into a new slot while earlier ones are transmitted.
 #endif // #if TRICE_MODE == 200
 
 
@@ -83,6 +112,26 @@ extern uint32_t ReadTime( void );
 #define TRICE_SINGLE_MAX_SIZE 800 //!< must not exeed TRICE_HALF_BUFFER_SIZE!
 #endif // #if TRICE_MODE == 201
 
+//! Lock-free ring buffer output to RTT or UART with cycle counter. Trices inside interrupts allowed without disabling them. Fast TRICE macro execution.
+//! Each TRICE is written into a small stack buffer and then copied into the ring after a compare-and-swap reservation.
+//! Needs TRICE_CAS and TRICE_MEMORY_BARRIER in the compiler adaption below.
+//! UART Command line similar to: `trice log -p COM1 -baud 115200`
+//! RTT Command line similar to: `trice l -args="-Device STM32G071RB -if SWD -Speed 4000 -RTTChannel 0 -RTTSearchRanges 0x20000000_0x1000"`
+#if TRICE_MODE == 300
+#define TRICE_RING_BUFFER_SIZE 2048 //!< This is the ring size. Must be a power of 2 and able to hold the max TRICE burst count within TRICE_TRANSFER_INTERVAL_MS.
+#define TRICE_RING_TRANSFER_SIZE 1024 //!< This is the max byte count moved out of the ring with one TriceTransfer. Must not exceed SEGGER BUFFER_SIZE_UP
+#define TRICE_SINGLE_MAX_SIZE 112 //!< TRICE_SINGLE_MAX_SIZE is the stack buffer size for one TRICE. Check TriceDepthMax at runtime.
+#ifndef TRICE_ENTER
+#define TRICE_ENTER { /*! Start of TRICE macro */ \
+    uint32_t co[TRICE_SINGLE_MAX_SIZE>>2]; \
+    uint32_t* TriceBufferWritePosition = co;
+#endif
+#ifndef TRICE_LEAVE
+#define TRICE_LEAVE { /*! End of TRICE macro */ \
+    TriceRingWrite( co, TriceBufferWritePosition - co ); } }
+#endif
+#endif // #if TRICE_MODE == 300
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -128,6 +177,12 @@ extern uint32_t ReadTime( void );
 //! TRICE_LEAVE_CRITICAL_SECTION restores interrupt state.
 #define TRICE_LEAVE_CRITICAL_SECTION } // to do
 
+//! TRICE_CAS replaces *p with desired and returns !0, if *p equals *pExpected. Otherwise it copies *p into *pExpected and returns 0.
+#define TRICE_CAS( p, pExpected, desired ) __atomic_compare_exchange_n( (p), (pExpected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __atomic_thread_fence( __ATOMIC_SEQ_CST )
+
 #elif defined(__arm__) // ARMkeil IDE #########################################
 
 #include <cmsis_armcc.h>
@@ -155,6 +210,40 @@ extern uint32_t ReadTime( void );
 //! you can leave this macro pair empty for more speed. Use only '}' in that case.
 #define TRICE_LEAVE_CRITICAL_SECTION } __set_PRIMASK(primaskstate); }
 
+//! triceCAS replaces *p with desired and returns !0, if *p equals *pExpected. Otherwise it copies *p into *pExpected and returns 0.
+//! It could fail also spuriously, so use it only in a loop.
+#if defined( __ARM_ARCH_6M__ ) || defined( __TARGET_ARCH_6S_M ) // Cortex M0 and M0+ have no LDREX/STREX
+TRICE_INLINE int triceCAS( volatile uint32_t* p, uint32_t* pExpected, uint32_t desired ){
+    int done;
+    uint32_t primaskstate = __get_PRIMASK(); // only these few instructions run with disabled interrupts
+    __disable_irq();
+    done = *p == *pExpected;
+    if( done ){
+        *p = desired;
+    }else{
+        *pExpected = *p;
+    }
+    __set_PRIMASK(primaskstate);
+    return done;
+}
+#else
+TRICE_INLINE int triceCAS( volatile uint32_t* p, uint32_t* pExpected, uint32_t desired ){
+    uint32_t v = __LDREXW( p );
+    if( v != *pExpected ){
+        __CLREX();
+        *pExpected = v;
+        return 0;
+    }
+    return 0 == __STREXW( desired, p ); // an interrupt between LDREX and STREX lets the store fail
+}
+#endif
+
+//! TRICE_CAS is the compare-and-swap used for the lock-free TRICE_RING_BUFFER_SIZE mode.
+#define TRICE_CAS( p, pExpected, desired ) triceCAS( p, pExpected, desired )
+
+//! TRICE_MEMORY_BARRIER orders the memory accesses before and after it.
+#define TRICE_MEMORY_BARRIER() __DMB()
+
 #elif 1 // ####################################################################
 #error "add new compiler here"
 #else // ######################################################################
@@ -176,6 +265,20 @@ static inline void ToggleOpticalFeedbackLED( void ){
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////////
+// Flush request: Adapt to your device.
+//
+
+#ifdef TRICE_FLUSH_HIGH_WATER
+//! TRICE_FLUSH_REQUEST is called inside the TRICE macros, when the trice buffer is filled above TRICE_FLUSH_HIGH_WATER.
+//! It pends the PendSV interrupt here, which calls TriceTransfer. An RTOS could notify a task instead.
+//! User must provide this macro.
+#define TRICE_FLUSH_REQUEST() do{ SCB->ICSR = SCB_ICSR_PENDSVSET_Msk; }while(0)
+#endif
+
+//
+///////////////////////////////////////////////////////////////////////////////
+
 ///////////////////////////////////////////////////////////////////////////////
 // UART interface: Adapt to your device.
 //
@@ -211,6 +314,23 @@ TRICE_INLINE void triceDisableTxEmptyInterrupt(void) {
     LL_USART_DisableIT_TXE(TRICE_UART);
 }
 
+#ifdef TRICE_UART_DMA
+//! triceStartDmaTransmit starts the transfer of len bytes from buf to the trice UART transmit register.
+//! The DMA transfer complete interrupt must call TriceDmaTransmitComplete.
+//! DMA1 channel 1 is used here. Its interrupt needs to be enabled in the NVIC.
+//! User must provide this function.
+TRICE_INLINE void triceStartDmaTransmit( uint8_t const * buf, unsigned len ){
+    LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_1);
+    LL_DMA_SetPeriphRequest(DMA1, LL_DMA_CHANNEL_1, LL_DMAMUX_REQ_USART2_TX);
+    LL_DMA_ConfigTransfer(DMA1, LL_DMA_CHANNEL_1, LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE | LL_DMA_PRIORITY_LOW);
+    LL_DMA_ConfigAddresses(DMA1, LL_DMA_CHANNEL_1, (uint32_t)buf, LL_USART_DMA_GetRegAddr(TRICE_UART, LL_USART_DMA_REG_DATA_TRANSMIT), LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetDataLength(DMA1, LL_DMA_CHANNEL_1, len);
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_CHANNEL_1);
+    LL_USART_EnableDMAReq_TX(TRICE_UART);
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_1);
+}
+#endif // #ifdef TRICE_UART_DMA
+
 #endif // #ifdef TRICE_STM32
 
 //
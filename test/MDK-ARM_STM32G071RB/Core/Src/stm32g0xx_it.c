@@ -115,6 +115,9 @@ void SVC_Handler(void)
 void PendSV_Handler(void)
 {
   /* USER CODE BEGIN PendSV_IRQn 0 */
+#if defined( TRICE_FLUSH_HIGH_WATER )
+    TriceTransfer(); // requested by TRICE_FLUSH_REQUEST
+#endif
 
   /* USER CODE END PendSV_IRQn 0 */
   /* USER CODE BEGIN PendSV_IRQn 1 */
@@ -135,7 +138,7 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
 
   /* USER CODE BEGIN SysTick_IRQn 1 */
-#if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE ) // buffered out to UART
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && !defined( TRICE_UART_DMA ) // buffered out to UART
     triceTriggerTransmit();
 #endif
   /* USER CODE END SysTick_IRQn 1 */
@@ -167,8 +170,13 @@ void USART2_IRQHandler(void)
         index += index < TRICE_COMMAND_SIZE_MAX ? 1 : 0; 
         if( v == 0 ){ // command end
             TRICE_S( Id(58565), "rx:received command:%s\n", rxBuf );
-            strcpy(triceCommand, rxBuf );
-            triceCommandFlag = 1;
+            #ifdef TRICE_ID_BITMAP_BITS
+            if( !TriceIdCommand( rxBuf ) ) // trice ID commands like "@-58565" are executed immediately
+            #endif
+            {
+                strcpy(triceCommand, rxBuf );
+                triceCommandFlag = 1;
+            }
             index = 0;
         }
         return;
@@ -177,7 +185,7 @@ void USART2_IRQHandler(void)
 
     // If both flags active and only one was served, the IRQHandler gets activated again.
 
-#if defined( TRICE_UART ) && defined( TRICE_HALF_BUFFER_SIZE ) // buffered out to UART
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && !defined( TRICE_UART_DMA ) // buffered out to UART
     if( LL_USART_IsActiveFlag_TXE(TRICE_UART) ){ // Transmit Data Register Empty Flag
         triceServeTransmit();
         return;
@@ -192,5 +200,19 @@ void USART2_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+#if defined( TRICE_UART ) && defined( TRICE_DEFERRED_OUT ) && defined( TRICE_UART_DMA ) // buffered out to UART with DMA
+/**
+  * @brief This function handles DMA1 channel 1 interrupt.
+  */
+void DMA1_Channel1_IRQHandler(void)
+{
+    if( LL_DMA_IsActiveFlag_TC1(DMA1) ){
+        LL_DMA_ClearFlag_TC1(DMA1);
+        LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_1);
+        TriceDmaTransmitComplete();
+    }
+}
+#endif
+
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/